@@ -4,5 +4,8 @@
 #include "lexer/lexer.hpp"
 #include "parser/parser.hpp"
 #include "interpreter/interpreter.hpp"
+#include "resolver/resolver.hpp"
+#include "vm/vm.hpp"
+#include "optimizer/optimizer.hpp"
 
 #endif
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "env.hpp"
 #include <iostream>
 
-bool tlang::env::validate_mutability(langgen::env::EnvValue value) {
+bool tlang::env::validate_mutability(const langgen::env::EnvValue& value) {
 	std::cout << (value.properties.at("isMutable") == "true") << std::endl;
 	try {
 		return value.properties.at("isMutable") == "true";
@@ -5,7 +5,7 @@
 
 namespace tlang {
 	namespace env {
-		bool validate_mutability(langgen::env::EnvValue value);
+		bool validate_mutability(const langgen::env::EnvValue& value);
 	}
 }
 
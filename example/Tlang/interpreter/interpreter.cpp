@@ -1,159 +1,179 @@
 #include "interpreter.hpp"
 
-std::shared_ptr<langgen::values::RuntimeValue> tlang::interpreter::evaluate_identifier(
+langgen::values::Value tlang::interpreter::evaluate_identifier(
 	langgen::interpreter::Interpreter& interpreter,
-	std::shared_ptr<langgen::ast::Statement> statement,
-	std::shared_ptr<langgen::env::Environment> env
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
 ) {
-	std::shared_ptr<tlang::ast::Identifier> identifier = std::dynamic_pointer_cast<tlang::ast::Identifier>(statement);
-	return env->get_value(identifier->get_name());
+	std::shared_ptr<tlang::ast::Identifier> identifier = std::static_pointer_cast<tlang::ast::Identifier>(statement);
+	std::optional<langgen::env::SlotAddress> address = identifier->get_address();
+	if(address.has_value()) {
+		return env->get_at(address.value());
+	}
+	return env->get(identifier->get_name());
 }
 
-std::shared_ptr<langgen::values::RuntimeValue> tlang::interpreter::evaluate_boolean_expression(
+langgen::values::Value tlang::interpreter::evaluate_boolean_expression(
 	langgen::interpreter::Interpreter& interpreter,
-	std::shared_ptr<langgen::ast::Statement> statement,
-	std::shared_ptr<langgen::env::Environment> env
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
 ) {
-	std::shared_ptr<tlang::ast::BooleanExpression> booleanExpression = std::dynamic_pointer_cast<tlang::ast::BooleanExpression>(statement);
-
-	return std::make_shared<tlang::values::BooleanValue>(booleanExpression->value);
+	return langgen::values::Value::boolean(
+		std::static_pointer_cast<tlang::ast::BooleanExpression>(statement)->value
+	);
 };
 
-std::shared_ptr<langgen::values::RuntimeValue> tlang::interpreter::evaluate_unary_expression(
+langgen::values::Value tlang::interpreter::logical_not(const langgen::values::Value& term) {
+	return langgen::values::Value::boolean(!term.IsTrue());
+}
+
+langgen::values::Value tlang::interpreter::add(const langgen::values::Value& left, const langgen::values::Value& right) {
+	if(!left.is_number() || !right.is_number()) {
+		throw std::runtime_error("Trying to add invalid operands");
+	}
+	return langgen::values::Value::number(left.get_number() + right.get_number());
+}
+
+langgen::values::Value tlang::interpreter::subtract(const langgen::values::Value& left, const langgen::values::Value& right) {
+	if(!left.is_number() || !right.is_number()) {
+		throw std::runtime_error("Trying to subtract invalid operands");
+	}
+	return langgen::values::Value::number(left.get_number() - right.get_number());
+}
+
+langgen::values::Value tlang::interpreter::multiply(const langgen::values::Value& left, const langgen::values::Value& right) {
+	if(!left.is_number() || !right.is_number()) {
+		throw std::runtime_error("Trying to multiply invalid operands");
+	}
+	return langgen::values::Value::number(left.get_number() * right.get_number());
+}
+
+langgen::values::Value tlang::interpreter::divide(const langgen::values::Value& left, const langgen::values::Value& right) {
+	if(!left.is_number() || !right.is_number()) {
+		throw std::runtime_error("Trying to divide invalid operands");
+	}
+	if(right.get_number() == 0) {
+		throw std::runtime_error("Trying to divide by zero");
+	}
+	return langgen::values::Value::number(left.get_number() / right.get_number());
+}
+
+langgen::values::Value tlang::interpreter::logical_and(const langgen::values::Value& left, const langgen::values::Value& right) {
+	return langgen::values::Value::boolean(left.IsTrue() && right.IsTrue());
+}
+
+langgen::values::Value tlang::interpreter::logical_or(const langgen::values::Value& left, const langgen::values::Value& right) {
+	return langgen::values::Value::boolean(left.IsTrue() || right.IsTrue());
+}
+
+langgen::values::Value tlang::interpreter::evaluate_unary_expression(
 	langgen::interpreter::Interpreter& interpreter,
-	std::shared_ptr<langgen::ast::Statement> statement,
-	std::shared_ptr<langgen::env::Environment> env
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
 ) {
-	std::shared_ptr<tlang::ast::UnaryExpression> unaryExpression = std::dynamic_pointer_cast<tlang::ast::UnaryExpression>(statement);
+	std::shared_ptr<tlang::ast::UnaryExpression> unaryExpression = std::static_pointer_cast<tlang::ast::UnaryExpression>(statement);
 
-	std::shared_ptr<langgen::values::RuntimeValue> term = langgen::interpreter::evaluate_statement(interpreter, unaryExpression->get_term(), env);
+	langgen::values::Value term = langgen::interpreter::evaluate_value(interpreter, unaryExpression->get_term(), env);
 	std::string operator_symbol = unaryExpression->get_operator_symbol();
 
 	if(operator_symbol == "!") {
-		return std::make_shared<tlang::values::BooleanValue>(!term->IsTrue());
+		return tlang::interpreter::logical_not(term);
 	}
 
 	throw std::runtime_error("Unknown unary operator " + operator_symbol);
 }
 
-std::shared_ptr<langgen::values::RuntimeValue> tlang::interpreter::evaluate_binary_expression(
+langgen::values::Value tlang::interpreter::evaluate_binary_expression(
 	langgen::interpreter::Interpreter& interpreter,
-	std::shared_ptr<langgen::ast::Statement> statement,
-	std::shared_ptr<langgen::env::Environment> env
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
 ) {
-	std::shared_ptr<tlang::ast::BinaryExpression> binaryExpression = std::dynamic_pointer_cast<tlang::ast::BinaryExpression>(statement);
+	std::shared_ptr<tlang::ast::BinaryExpression> binaryExpression = std::static_pointer_cast<tlang::ast::BinaryExpression>(statement);
 
-	std::shared_ptr<langgen::values::RuntimeValue> left = langgen::interpreter::evaluate_statement(interpreter, binaryExpression->get_left(), env);
-	std::shared_ptr<langgen::values::RuntimeValue> right = langgen::interpreter::evaluate_statement(interpreter, binaryExpression->get_right(), env);
+	langgen::values::Value left = langgen::interpreter::evaluate_value(interpreter, binaryExpression->get_left(), env);
+	langgen::values::Value right = langgen::interpreter::evaluate_value(interpreter, binaryExpression->get_right(), env);
 
 	std::string operator_symbol = binaryExpression->get_operator_symbol();
 
 	if(operator_symbol == "+") {
-		if(
-			left->type() == "NumberValue" &&
-			right->type() == "NumberValue"
-		) {
-			throw std::runtime_error("Trying to add invalid operands");
-		}
-
-		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
-		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
-		
-		return std::make_shared<langgen::values::NumberValue>(left_nb + right_nb);
+		return tlang::interpreter::add(left, right);
 	}
 	if(operator_symbol == "-") {
-		if(
-			left->type() == "NumberValue" &&
-			right->type() == "NumberValue"
-		) {
-			throw std::runtime_error("Trying to subtract invalid operands");
-		}
-		
-		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
-		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
-		
-		return std::make_shared<langgen::values::NumberValue>(left_nb - right_nb);
+		return tlang::interpreter::subtract(left, right);
 	}
 	if(operator_symbol == "*") {
-		if(
-			left->type() == "NumberValue" &&
-			right->type() == "NumberValue"
-		) {
-			throw std::runtime_error("Trying to multiply invalid operands");
-		}
-		
-		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
-		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
-		
-		return std::make_shared<langgen::values::NumberValue>(left_nb * right_nb);
+		return tlang::interpreter::multiply(left, right);
 	}
 	if(operator_symbol == "/") {
-		if(
-			left->type() == "NumberValue" &&
-			right->type() == "NumberValue"
-		) {
-			throw std::runtime_error("Trying to divide invalid operands");
-		}
-		
-		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
-		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
-
-		if(right_nb == 0) {
-			throw std::runtime_error("Trying to divide by zero");
-		}
-		
-		return std::make_shared<langgen::values::NumberValue>(left_nb / right_nb);
+		return tlang::interpreter::divide(left, right);
 	}
 	if(operator_symbol == "&&") {
-		return std::make_shared<tlang::values::BooleanValue>(left->IsTrue() && right->IsTrue());
+		return tlang::interpreter::logical_and(left, right);
 	}
 	if(operator_symbol == "||") {
-		return std::make_shared<tlang::values::BooleanValue>(left->IsTrue() || right->IsTrue());
+		return tlang::interpreter::logical_or(left, right);
 	}
 
 	throw std::runtime_error("Unknown operator " + operator_symbol);
 }
 
-std::shared_ptr<langgen::values::RuntimeValue> tlang::interpreter::evaluate_assignation_expression(
+langgen::values::Value tlang::interpreter::evaluate_assignation_expression(
 	langgen::interpreter::Interpreter& interpreter,
-	std::shared_ptr<langgen::ast::Statement> statement,
-	std::shared_ptr<langgen::env::Environment> env
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
 ) {
-	std::shared_ptr<tlang::ast::AssignationExpression> assignationExpression = std::dynamic_pointer_cast<tlang::ast::AssignationExpression>(statement);
+	std::shared_ptr<tlang::ast::AssignationExpression> assignationExpression = std::static_pointer_cast<tlang::ast::AssignationExpression>(statement);
 
-	return env->set_value(
+	langgen::values::Value value = langgen::interpreter::evaluate_value(
+		interpreter,
+		assignationExpression->get_value(),
+		env
+	);
+
+	std::optional<langgen::env::SlotAddress> address = assignationExpression->get_identifier()->get_address();
+	if(address.has_value()) {
+		return env->set_at(address.value(), value);
+	}
+	return env->set(
 		assignationExpression->get_identifier()->get_name(),
-		langgen::interpreter::evaluate_statement(
-			interpreter,
-			assignationExpression->get_value(),
-			env
-		)
+		value
 	);
 }
 
-std::shared_ptr<langgen::values::RuntimeValue> tlang::interpreter::evaluate_declaration_expression(
+langgen::values::Value tlang::interpreter::evaluate_declaration_expression(
 	langgen::interpreter::Interpreter& interpreter,
-	std::shared_ptr<langgen::ast::Statement> statement,
-	std::shared_ptr<langgen::env::Environment> env
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
 ) {
-	std::shared_ptr<tlang::ast::DeclarationExpression> declarationExpression = std::dynamic_pointer_cast<tlang::ast::DeclarationExpression>(statement);
+	std::shared_ptr<tlang::ast::DeclarationExpression> declarationExpression = std::static_pointer_cast<tlang::ast::DeclarationExpression>(statement);
 
-	return env->init_value(
+	langgen::values::Value value = langgen::interpreter::evaluate_value(
+		interpreter,
+		declarationExpression->get_value(),
+		env
+	);
+	langgen::env::Properties properties(env->get_schema());
+	properties.set("isMutable", declarationExpression->get_mutability() ? "true" : "false");
+
+	std::optional<size_t> slot = declarationExpression->get_slot();
+	if(slot.has_value()) {
+		return env->init_at(
+			slot.value(),
+			declarationExpression->get_identifier()->get_name(),
+			value,
+			properties
+		);
+	}
+	return env->init(
 		declarationExpression->get_identifier()->get_name(),
-		langgen::interpreter::evaluate_statement(
-			interpreter,
-			declarationExpression->get_value(),
-			env
-		),
-		{
-			{ "isMutable", declarationExpression->get_mutability() ? "true" : "false" }
-		}
+		value,
+		properties
 	);
 }
 
 void setup_interpreter(langgen::interpreter::Interpreter& interpreter) {
 
-	std::unordered_map<std::string, langgen::interpreter::ParseStatementFunction> nodeEvaluationFunctions = std::unordered_map<std::string, langgen::interpreter::ParseStatementFunction>({
+	std::unordered_map<std::string, langgen::interpreter::EvaluateValueFunction> nodeValueEvaluationFunctions = std::unordered_map<std::string, langgen::interpreter::EvaluateValueFunction>({
 		{
 			"DeclarationExpression",
 			&tlang::interpreter::evaluate_declaration_expression
@@ -197,8 +217,9 @@ void setup_interpreter(langgen::interpreter::Interpreter& interpreter) {
 
 	langgen::interpreter::setup_interpreter(
 		interpreter,
-		nodeEvaluationFunctions,
+		std::unordered_map<std::string, langgen::interpreter::ParseStatementFunction>(),
 		envValuesProperties,
-		validationRules
+		validationRules,
+		nodeValueEvaluationFunctions
 	);
 }
\ No newline at end of file
@@ -10,35 +10,43 @@ void setup_interpreter(langgen::interpreter::Interpreter& interpreter);
 
 namespace tlang {
 	namespace interpreter {
-		std::shared_ptr<langgen::values::RuntimeValue> evaluate_identifier(
+		langgen::values::Value logical_not(const langgen::values::Value& term);
+		langgen::values::Value add(const langgen::values::Value& left, const langgen::values::Value& right);
+		langgen::values::Value subtract(const langgen::values::Value& left, const langgen::values::Value& right);
+		langgen::values::Value multiply(const langgen::values::Value& left, const langgen::values::Value& right);
+		langgen::values::Value divide(const langgen::values::Value& left, const langgen::values::Value& right);
+		langgen::values::Value logical_and(const langgen::values::Value& left, const langgen::values::Value& right);
+		langgen::values::Value logical_or(const langgen::values::Value& left, const langgen::values::Value& right);
+
+		langgen::values::Value evaluate_identifier(
 			langgen::interpreter::Interpreter& interpreter,
-			std::shared_ptr<langgen::ast::Statement> statement,
-			std::shared_ptr<langgen::env::Environment> env
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
 		);
-		std::shared_ptr<langgen::values::RuntimeValue> evaluate_boolean_expression(
+		langgen::values::Value evaluate_boolean_expression(
 			langgen::interpreter::Interpreter& interpreter,
-			std::shared_ptr<langgen::ast::Statement> statement,
-			std::shared_ptr<langgen::env::Environment> env
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
 		);
-		std::shared_ptr<langgen::values::RuntimeValue> evaluate_unary_expression(
+		langgen::values::Value evaluate_unary_expression(
 			langgen::interpreter::Interpreter& interpreter,
-			std::shared_ptr<langgen::ast::Statement> statement,
-			std::shared_ptr<langgen::env::Environment> env
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
 		);
-		std::shared_ptr<langgen::values::RuntimeValue> evaluate_binary_expression(
+		langgen::values::Value evaluate_binary_expression(
 			langgen::interpreter::Interpreter& interpreter,
-			std::shared_ptr<langgen::ast::Statement> statement,
-			std::shared_ptr<langgen::env::Environment> env
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
 		);
-		std::shared_ptr<langgen::values::RuntimeValue> evaluate_assignation_expression(
+		langgen::values::Value evaluate_assignation_expression(
 			langgen::interpreter::Interpreter& interpreter,
-			std::shared_ptr<langgen::ast::Statement> statement,
-			std::shared_ptr<langgen::env::Environment> env
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
 		);
-		std::shared_ptr<langgen::values::RuntimeValue> evaluate_declaration_expression(
+		langgen::values::Value evaluate_declaration_expression(
 			langgen::interpreter::Interpreter& interpreter,
-			std::shared_ptr<langgen::ast::Statement> statement,
-			std::shared_ptr<langgen::env::Environment> env
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
 		);
 	}
 }
@@ -5,22 +5,10 @@
 
 namespace tlang {
 	namespace values {
-		class BooleanValue: public langgen::values::RuntimeValue {
-		public:
-			/**
-			 * Create a new Boolean Value
-			 */
-			BooleanValue(bool value = false);
-			
-			bool get();
-
-			virtual std::string type() override;
-			virtual std::string repr() override;
-			virtual bool IsTrue() override;
-
-		private:
-			bool value;
-		};
+		/**
+		 * Booleans are provided by langgen, and stored unboxed in a langgen::values::Value
+		 */
+		typedef langgen::values::BooleanValue BooleanValue;
 	}
 }
 
@@ -1,5 +1,18 @@
 #include "lexer.hpp"
 
+const langgen::lexer::TokenKind tlang::lexer::ASSIGN_KEYWORD = langgen::lexer::token_kind("ASSIGN_KEYWORD");
+const langgen::lexer::TokenKind tlang::lexer::SEMICOLON = langgen::lexer::token_kind("SEMICOLON");
+const langgen::lexer::TokenKind tlang::lexer::COLON = langgen::lexer::token_kind("COLON");
+const langgen::lexer::TokenKind tlang::lexer::ASSIGN = langgen::lexer::token_kind("ASSIGN");
+const langgen::lexer::TokenKind tlang::lexer::OPEN_PAREN = langgen::lexer::token_kind("OPEN_PAREN");
+const langgen::lexer::TokenKind tlang::lexer::CLOSE_PAREN = langgen::lexer::token_kind("CLOSE_PAREN");
+const langgen::lexer::TokenKind tlang::lexer::OPERATOR = langgen::lexer::token_kind("OPERATOR");
+const langgen::lexer::TokenKind tlang::lexer::UNARY_OPERATOR = langgen::lexer::token_kind("UNARY_OPERATOR");
+const langgen::lexer::TokenKind tlang::lexer::BOOL = langgen::lexer::token_kind("BOOL");
+const langgen::lexer::TokenKind tlang::lexer::TYPE = langgen::lexer::token_kind("TYPE");
+const langgen::lexer::TokenKind tlang::lexer::NUMBER = langgen::lexer::token_kind("NUMBER");
+const langgen::lexer::TokenKind tlang::lexer::IDENTIFIER = langgen::lexer::token_kind("IDENTIFIER");
+
 void setup_lexer(langgen::lexer::Lexer& lexer) {
 	std::vector<langgen::lexer::TokenType> tokenTypes = std::vector<langgen::lexer::TokenType>({
 		langgen::lexer::make_token_type("ASSIGN_KEYWORD", "let"),
@@ -22,37 +35,29 @@ void setup_lexer(langgen::lexer::Lexer& lexer) {
 		langgen::lexer::make_token_type("TYPE", "boolean"),
 		langgen::lexer::make_token_type(
 			"NUMBER",
-			[lexer](std::string src) -> std::string {
-				std::string number = "";
+			[lexer](std::string_view src) -> size_t {
 				size_t i = 0;
 				bool isInteger = true;
-				while(isdigit(src.at(i)) || src.at(i) == lexer.decimalSeparator) {
+				while(i < src.length() && (isdigit(src.at(i)) || src.at(i) == lexer.decimalSeparator)) {
 					if(src.at(i) == lexer.decimalSeparator) {
 						if(!isInteger) {
 							throw std::runtime_error("Invalid number format");
 						}
 						isInteger = false;
 					}
-					number += src.at(i);
-					if(++i == src.length()) {
-						break;
-					}
+					i++;
 				}
-				return number;
+				return i;
 			}
 		),
 		langgen::lexer::make_token_type(
 			"IDENTIFIER",
-			[lexer](std::string src) -> std::string {
-				std::string identifier = "";
+			[](std::string_view src) -> size_t {
 				size_t i = 0;
-				while(isalpha(src.at(i)) || src.at(i) == '_') {
-					identifier += src.at(i);
-					if(++i == src.length()) {
-						break;
-					}
+				while(i < src.length() && (isalpha(src.at(i)) || src.at(i) == '_')) {
+					i++;
 				}
-				return identifier;
+				return i;
 			}
 		)
 	});
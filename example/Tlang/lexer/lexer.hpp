@@ -5,4 +5,21 @@
 
 void setup_lexer(langgen::lexer::Lexer& lexer);
 
+namespace tlang {
+	namespace lexer {
+		extern const langgen::lexer::TokenKind ASSIGN_KEYWORD;
+		extern const langgen::lexer::TokenKind SEMICOLON;
+		extern const langgen::lexer::TokenKind COLON;
+		extern const langgen::lexer::TokenKind ASSIGN;
+		extern const langgen::lexer::TokenKind OPEN_PAREN;
+		extern const langgen::lexer::TokenKind CLOSE_PAREN;
+		extern const langgen::lexer::TokenKind OPERATOR;
+		extern const langgen::lexer::TokenKind UNARY_OPERATOR;
+		extern const langgen::lexer::TokenKind BOOL;
+		extern const langgen::lexer::TokenKind TYPE;
+		extern const langgen::lexer::TokenKind NUMBER;
+		extern const langgen::lexer::TokenKind IDENTIFIER;
+	}
+}
+
 #endif // __T_LEXER__
\ No newline at end of file
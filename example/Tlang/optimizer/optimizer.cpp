@@ -0,0 +1,129 @@
+#include "optimizer.hpp"
+
+/**
+ * Fold a child expression, keeping it if it is replaced by something else than an expression
+ */
+static std::shared_ptr<langgen::ast::Expression> fold_expression(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Expression>& expression
+) {
+	std::shared_ptr<langgen::ast::Expression> folded = std::dynamic_pointer_cast<langgen::ast::Expression>(
+		langgen::optimizer::fold_statement(optimizer, expression)
+	);
+	return folded != nullptr ? folded : expression;
+}
+
+std::shared_ptr<langgen::ast::Statement> tlang::optimizer::fold_identifier(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::Identifier> identifier = std::static_pointer_cast<tlang::ast::Identifier>(statement);
+
+	std::shared_ptr<langgen::ast::Statement> constant = langgen::optimizer::lookup_constant(optimizer, identifier->get_name());
+	return constant != nullptr ? constant : statement;
+}
+
+std::shared_ptr<langgen::ast::Statement> tlang::optimizer::fold_unary_expression(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::UnaryExpression> unaryExpression = std::static_pointer_cast<tlang::ast::UnaryExpression>(statement);
+
+	unaryExpression->set_term(fold_expression(optimizer, unaryExpression->get_term()));
+
+	if(langgen::optimizer::is_literal(optimizer, unaryExpression->get_term())) {
+		return langgen::optimizer::fold_constant(optimizer, statement);
+	}
+	return statement;
+}
+
+std::shared_ptr<langgen::ast::Statement> tlang::optimizer::fold_binary_expression(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::BinaryExpression> binaryExpression = std::static_pointer_cast<tlang::ast::BinaryExpression>(statement);
+
+	binaryExpression->set_left(fold_expression(optimizer, binaryExpression->get_left()));
+	binaryExpression->set_right(fold_expression(optimizer, binaryExpression->get_right()));
+
+	if(
+		langgen::optimizer::is_literal(optimizer, binaryExpression->get_left()) &&
+		langgen::optimizer::is_literal(optimizer, binaryExpression->get_right())
+	) {
+		return langgen::optimizer::fold_constant(optimizer, statement);
+	}
+	return statement;
+}
+
+std::shared_ptr<langgen::ast::Statement> tlang::optimizer::fold_assignation_expression(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::AssignationExpression> assignationExpression = std::static_pointer_cast<tlang::ast::AssignationExpression>(statement);
+
+	// The assigned identifier is a target, not a value, it is never replaced
+	assignationExpression->set_value(fold_expression(optimizer, assignationExpression->get_value()));
+
+	return statement;
+}
+
+std::shared_ptr<langgen::ast::Statement> tlang::optimizer::fold_declaration_expression(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::DeclarationExpression> declarationExpression = std::static_pointer_cast<tlang::ast::DeclarationExpression>(statement);
+
+	// The value is folded before the key is declared
+	declarationExpression->set_value(fold_expression(optimizer, declarationExpression->get_value()));
+
+	// Only the bindings the environment keeps immutable are propagated
+	bool isConstant = !declarationExpression->get_mutability() && langgen::optimizer::is_literal(optimizer, declarationExpression->get_value());
+
+	langgen::optimizer::declare(
+		optimizer,
+		declarationExpression->get_identifier()->get_name(),
+		isConstant ? declarationExpression->get_value() : nullptr
+	);
+
+	return statement;
+}
+
+void setup_optimizer(langgen::optimizer::Optimizer& optimizer, langgen::interpreter::Interpreter& interpreter) {
+	langgen::optimizer::setup_optimizer(
+		optimizer,
+		interpreter,
+		{
+			{
+				"DeclarationExpression",
+				&tlang::optimizer::fold_declaration_expression
+			},
+			{
+				"AssignationExpression",
+				&tlang::optimizer::fold_assignation_expression
+			},
+			{
+				"Identifier",
+				&tlang::optimizer::fold_identifier
+			},
+			{
+				"UnaryExpression",
+				&tlang::optimizer::fold_unary_expression
+			},
+			{
+				"BinaryExpression",
+				&tlang::optimizer::fold_binary_expression
+			},
+		},
+		{
+			langgen::optimizer::LiteralType{
+				"BooleanExpression",
+				[] (const langgen::values::Value& value) -> std::shared_ptr<langgen::ast::Statement> {
+					if(!value.is_boolean()) {
+						return nullptr;
+					}
+					return langgen::ast::make<tlang::ast::BooleanExpression>(value.get_boolean());
+				}
+			}
+		}
+	);
+}
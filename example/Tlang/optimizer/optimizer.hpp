@@ -0,0 +1,34 @@
+#ifndef __T_OPTIMIZER__
+#define __T_OPTIMIZER__
+
+#include "../parser/ast.hpp"
+#include <AquIce/langgen/optimizer.hpp>
+
+void setup_optimizer(langgen::optimizer::Optimizer& optimizer, langgen::interpreter::Interpreter& interpreter);
+
+namespace tlang {
+	namespace optimizer {
+		std::shared_ptr<langgen::ast::Statement> fold_identifier(
+			langgen::optimizer::Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		std::shared_ptr<langgen::ast::Statement> fold_unary_expression(
+			langgen::optimizer::Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		std::shared_ptr<langgen::ast::Statement> fold_binary_expression(
+			langgen::optimizer::Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		std::shared_ptr<langgen::ast::Statement> fold_assignation_expression(
+			langgen::optimizer::Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		std::shared_ptr<langgen::ast::Statement> fold_declaration_expression(
+			langgen::optimizer::Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+	}
+}
+
+#endif // __T_OPTIMIZER__
@@ -16,6 +16,9 @@ std::shared_ptr<tlang::ast::Identifier> tlang::ast::AssignationExpression::get_i
 std::shared_ptr<langgen::ast::Expression> tlang::ast::AssignationExpression::get_value() {
 	return this->value;
 }
+void tlang::ast::AssignationExpression::set_value(std::shared_ptr<langgen::ast::Expression> value) {
+	this->value = value;
+}
 
 std::string tlang::ast::AssignationExpression::type() {
 	return "AssignationExpression";
@@ -43,6 +46,12 @@ std::string tlang::ast::DeclarationExpression::get_value_type() {
 bool tlang::ast::DeclarationExpression::get_mutability() {
 	return this->isMutable;
 }
+std::optional<size_t> tlang::ast::DeclarationExpression::get_slot() {
+	return this->slot;
+}
+void tlang::ast::DeclarationExpression::set_slot(size_t slot) {
+	this->slot = slot;
+}
 
 std::string tlang::ast::DeclarationExpression::type() {
 	return "DeclarationExpression";
@@ -66,6 +75,12 @@ tlang::ast::Identifier::Identifier(std::string name) {
 std::string tlang::ast::Identifier::get_name() {
 	return this->name;
 }
+std::optional<langgen::env::SlotAddress> tlang::ast::Identifier::get_address() {
+	return this->address;
+}
+void tlang::ast::Identifier::set_address(langgen::env::SlotAddress address) {
+	this->address = address;
+}
 std::string tlang::ast::Identifier::type() {
 	return "Identifier";
 }
@@ -103,6 +118,9 @@ tlang::ast::UnaryExpression::UnaryExpression(
 std::shared_ptr<langgen::ast::Expression> tlang::ast::UnaryExpression::get_term() {
 	return this->term;
 }
+void tlang::ast::UnaryExpression::set_term(std::shared_ptr<langgen::ast::Expression> term) {
+	this->term = term;
+}
 
 std::string tlang::ast::UnaryExpression::get_operator_symbol() {
 	return this->operator_symbol;
@@ -142,6 +160,12 @@ std::string tlang::ast::BinaryExpression::get_operator_symbol() {
 std::shared_ptr<langgen::ast::Expression> tlang::ast::BinaryExpression::get_right() {
 	return this->right;
 }
+void tlang::ast::BinaryExpression::set_left(std::shared_ptr<langgen::ast::Expression> left) {
+	this->left = left;
+}
+void tlang::ast::BinaryExpression::set_right(std::shared_ptr<langgen::ast::Expression> right) {
+	this->right = right;
+}
 
 std::string tlang::ast::BinaryExpression::type() {
 	return "BinaryExpression";
@@ -2,6 +2,9 @@
 #define __T_AST__
 
 #include <AquIce/langgen/ast.hpp>
+#include <AquIce/langgen/env.hpp>
+
+#include <optional>
 
 namespace tlang {
 	namespace ast {
@@ -11,12 +14,15 @@ namespace tlang {
 			Identifier(std::string name);
 			
 			std::string get_name();
+			std::optional<langgen::env::SlotAddress> get_address();
+			void set_address(langgen::env::SlotAddress address);
 
 			virtual std::string type() override;
 			virtual std::string repr(int indent = 0);
 
 		private:
 			std::string name;
+			std::optional<langgen::env::SlotAddress> address;
 		};
 
 		class AssignationExpression : public langgen::ast::Expression {
@@ -28,6 +34,7 @@ namespace tlang {
 
 			std::shared_ptr<Identifier> get_identifier();
 			std::shared_ptr<langgen::ast::Expression> get_value();
+			void set_value(std::shared_ptr<langgen::ast::Expression> value);
 
 			virtual std::string type() override;
 			virtual std::string repr(int indent = 0);
@@ -43,6 +50,8 @@ namespace tlang {
 
 			std::string get_value_type();
 			bool get_mutability();
+			std::optional<size_t> get_slot();
+			void set_slot(size_t slot);
 
 			virtual std::string type() override;
 			virtual std::string repr(int indent = 0);
@@ -50,6 +59,7 @@ namespace tlang {
 		private:
 			std::string value_type;
 			bool isMutable;
+			std::optional<size_t> slot;
 		};
 		
 		class BooleanExpression : public langgen::ast::Expression {
@@ -70,6 +80,7 @@ namespace tlang {
 			);
 
 			std::shared_ptr<Expression> get_term();
+			void set_term(std::shared_ptr<Expression> term);
 			std::string get_operator_symbol();
 
 			virtual std::string type() override;
@@ -91,6 +102,8 @@ namespace tlang {
 			std::shared_ptr<Expression> get_left();
 			std::string get_operator_symbol();
 			std::shared_ptr<Expression> get_right();
+			void set_left(std::shared_ptr<Expression> left);
+			void set_right(std::shared_ptr<Expression> right);
 			
 			virtual std::string type() override;
 			virtual std::string repr(int indent = 0);
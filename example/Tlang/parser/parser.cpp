@@ -34,133 +34,106 @@ void setup_parser(langgen::parser::Parser& parser) {
 	);
 
 	langgen::parser::demoteTopNode(parser, "NumberExpression");
+
+	// Declarations, and the assignations and expressions they fall back to
+	langgen::parser::set_first_tokens(
+		parser,
+		"DeclarationExpression",
+		{
+			"ASSIGN_KEYWORD",
+			"IDENTIFIER",
+			"NUMBER",
+			"BOOL",
+			"UNARY_OPERATOR"
+		}
+	);
 }
 
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_identifier(std::vector<langgen::lexer::Token>& tokens) {
-	if(peek(tokens).type == "IDENTIFIER") {
-		return std::make_shared<tlang::ast::Identifier>(eat(tokens).value);
+std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_identifier(langgen::parser::TokenStream& tokens) {
+	if(peek(tokens).kind == tlang::lexer::IDENTIFIER) {
+		return langgen::parser::make_statement<tlang::ast::Identifier>(tokens, eat(tokens).value);
 	}
 	return langgen::parser::parse_number_expression(tokens);
 }
 
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_boolean_expression(std::vector<langgen::lexer::Token>& tokens) {
-	if(peek(tokens).type == "BOOL") {
-		return std::make_shared<tlang::ast::BooleanExpression>(eat(tokens).value == "true");
+std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_boolean_expression(langgen::parser::TokenStream& tokens) {
+	if(peek(tokens).kind == tlang::lexer::BOOL) {
+		return langgen::parser::make_statement<tlang::ast::BooleanExpression>(tokens, eat(tokens).value == "true");
 	}
 	return tlang::parser::parse_identifier(tokens);
 }
 
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_unary_expression(std::vector<langgen::lexer::Token>& tokens) {
+std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_unary_expression(langgen::parser::TokenStream& tokens) {
 
 	std::string operator_symbol = "";
 
-	if(peek(tokens).type == "UNARY_OPERATOR") {
+	if(peek(tokens).kind == tlang::lexer::UNARY_OPERATOR) {
 		operator_symbol = eat(tokens).value;
 	}
 	
 	std::shared_ptr<langgen::ast::Expression> term = tlang::parser::parse_boolean_expression(tokens);
 
-	return operator_symbol.size() == 0 ? term : std::make_shared<tlang::ast::UnaryExpression>(term, operator_symbol);
+	return operator_symbol.size() == 0 ? term : langgen::parser::make_statement<tlang::ast::UnaryExpression>(tokens, term, operator_symbol);
 }
 
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_multiplicative_expression(std::vector<langgen::lexer::Token>& tokens) {
-	std::shared_ptr<langgen::ast::Expression> left = tlang::parser::parse_unary_expression(tokens);
-
-	if(left == nullptr) {
-		return nullptr;
-	}
-
-	if(
-		peek(tokens).type == "OPERATOR" &&
-		(peek(tokens).value == "*" || peek(tokens).value == "/")
-	) {
-		std::string operator_symbol = eat(tokens).value;
-		std::shared_ptr<langgen::ast::Expression> right = tlang::parser::parse_multiplicative_expression(tokens);
-		
-		return std::make_shared<tlang::ast::BinaryExpression>(
-			left,
-			operator_symbol,
-			right
-		);
-	}
-	
-	return left;
-}
-
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_additive_expression(std::vector<langgen::lexer::Token>& tokens) {
-	std::shared_ptr<langgen::ast::Expression> left = tlang::parser::parse_multiplicative_expression(tokens);
-
-	if(left == nullptr) {
-		return nullptr;
-	}
-
-	if(
-		peek(tokens).type == "OPERATOR" &&
-		(peek(tokens).value == "+" || peek(tokens).value == "-")
-	) {
-		std::string operator_symbol = eat(tokens).value;
-		std::shared_ptr<langgen::ast::Expression> right = tlang::parser::parse_additive_expression(tokens);
-		
-		return std::make_shared<tlang::ast::BinaryExpression>(
-			left,
-			operator_symbol,
-			right
-		);
-	}
-	
-	return left;
+static std::shared_ptr<langgen::ast::Expression> build_binary_expression(
+	langgen::parser::TokenStream& tokens,
+	std::shared_ptr<langgen::ast::Expression> left,
+	const langgen::lexer::Token& op,
+	std::shared_ptr<langgen::ast::Expression> right
+) {
+	return langgen::parser::make_statement<tlang::ast::BinaryExpression>(
+		tokens,
+		left,
+		op.value,
+		right
+	);
 }
 
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_logical_expression(std::vector<langgen::lexer::Token>& tokens) {
-	std::shared_ptr<langgen::ast::Expression> left = tlang::parser::parse_additive_expression(tokens);
-
-	if(left == nullptr) {
-		return nullptr;
-	}
-
-	if(
-		peek(tokens).type == "OPERATOR" &&
-		(peek(tokens).value == "&&" || peek(tokens).value == "||")
-	) {
-		std::string operator_symbol = eat(tokens).value;
-		std::shared_ptr<langgen::ast::Expression> right = tlang::parser::parse_logical_expression(tokens);
-		
-		return std::make_shared<tlang::ast::BinaryExpression>(
-			left,
-			operator_symbol,
-			right
-		);
-	}
-	
-	return left;
+const langgen::parser::OperatorTable& tlang::parser::get_operator_table() {
+	static const langgen::parser::OperatorTable table = langgen::parser::OperatorTable{
+		{
+			langgen::parser::make_binary_operator("OPERATOR", "*", 3, langgen::parser::Associativity::LEFT, &build_binary_expression),
+			langgen::parser::make_binary_operator("OPERATOR", "/", 3, langgen::parser::Associativity::LEFT, &build_binary_expression),
+			langgen::parser::make_binary_operator("OPERATOR", "+", 2, langgen::parser::Associativity::LEFT, &build_binary_expression),
+			langgen::parser::make_binary_operator("OPERATOR", "-", 2, langgen::parser::Associativity::LEFT, &build_binary_expression),
+			langgen::parser::make_binary_operator("OPERATOR", "&&", 1, langgen::parser::Associativity::LEFT, &build_binary_expression),
+			langgen::parser::make_binary_operator("OPERATOR", "||", 1, langgen::parser::Associativity::LEFT, &build_binary_expression),
+		},
+		&tlang::parser::parse_unary_expression
+	};
+	return table;
 }
 
-std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_binary_expression(std::vector<langgen::lexer::Token>& tokens) {
-	return tlang::parser::parse_logical_expression(tokens);
+std::shared_ptr<langgen::ast::Expression> tlang::parser::parse_binary_expression(langgen::parser::TokenStream& tokens) {
+	return langgen::parser::parse_expression(tlang::parser::get_operator_table(), tokens);
 }
 
-std::shared_ptr<langgen::ast::Statement> tlang::parser::parse_assignation_expression(std::vector<langgen::lexer::Token>& tokens) {
+std::shared_ptr<langgen::ast::Statement> tlang::parser::parse_assignation_expression(langgen::parser::TokenStream& tokens) {
+	size_t start = langgen::parser::mark(tokens);
 	
 	std::shared_ptr<langgen::ast::Expression> pseudoIdentifier = tlang::parser::parse_identifier(tokens);
 
-	if(pseudoIdentifier->type() != "Identifier") {
+	if(
+		pseudoIdentifier == nullptr ||
+		pseudoIdentifier->type() != "Identifier" ||
+		peek(tokens).kind != tlang::lexer::ASSIGN
+	) {
+		langgen::parser::reset(tokens, start);
 		return tlang::parser::parse_binary_expression(tokens);
 	}
 
 	std::shared_ptr<tlang::ast::Identifier> identifier = std::dynamic_pointer_cast<tlang::ast::Identifier>(pseudoIdentifier);
 
-	if(peek(tokens).type != "ASSIGN") {
-		return tlang::parser::parse_identifier(tokens);
-	}
 	(void)eat(tokens);
 
 	std::shared_ptr<langgen::ast::Expression> expression = tlang::parser::parse_binary_expression(tokens);
 
-	return std::make_shared<tlang::ast::AssignationExpression>(identifier, expression);
+	return langgen::parser::make_statement<tlang::ast::AssignationExpression>(tokens, identifier, expression);
 }
 
-std::shared_ptr<langgen::ast::Statement> tlang::parser::parse_declaration_expression(std::vector<langgen::lexer::Token>& tokens) {
-	if(peek(tokens).type != "ASSIGN_KEYWORD") {
+std::shared_ptr<langgen::ast::Statement> tlang::parser::parse_declaration_expression(langgen::parser::TokenStream& tokens) {
+	if(peek(tokens).kind != tlang::lexer::ASSIGN_KEYWORD) {
 		return parse_assignation_expression(tokens);
 	}
 
@@ -168,28 +141,28 @@ std::shared_ptr<langgen::ast::Statement> tlang::parser::parse_declaration_expres
 	
 	std::shared_ptr<langgen::ast::Expression> pseudoIdentifier = tlang::parser::parse_identifier(tokens);
 
-	if(pseudoIdentifier->type() != "Identifier") {
+	if(pseudoIdentifier == nullptr || pseudoIdentifier->type() != "Identifier") {
 		throw std::runtime_error("Expected identifier");
 	}
 
 	std::shared_ptr<tlang::ast::Identifier> identifier = std::dynamic_pointer_cast<tlang::ast::Identifier>(pseudoIdentifier);
 
-	if(peek(tokens).type != "COLON") {
+	if(peek(tokens).kind != tlang::lexer::COLON) {
 		throw std::runtime_error("Expected colon");
 	}
 	(void)eat(tokens);
 
-	if(peek(tokens).type != "TYPE") {
+	if(peek(tokens).kind != tlang::lexer::TYPE) {
 		throw std::runtime_error("Expected type specifier");
 	}
 	std::string type = eat(tokens).value;
 
-	if(peek(tokens).type != "ASSIGN") {
+	if(peek(tokens).kind != tlang::lexer::ASSIGN) {
 		throw std::runtime_error("Expected assignment symbol");
 	}
 	(void)eat(tokens);
 
 	std::shared_ptr<langgen::ast::Expression> expression = tlang::parser::parse_binary_expression(tokens);
 
-	return std::make_shared<tlang::ast::DeclarationExpression>(identifier, expression, type, isMutable);
+	return langgen::parser::make_statement<tlang::ast::DeclarationExpression>(tokens, identifier, expression, type, isMutable);
 }
\ No newline at end of file
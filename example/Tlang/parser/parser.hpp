@@ -4,28 +4,28 @@
 #include <AquIce/langgen/parser.hpp>
 
 #include "ast.hpp"
+#include "../lexer/lexer.hpp"
 
 void setup_parser(langgen::parser::Parser& parser);
 
 namespace tlang {
 	namespace parser {
-		std::shared_ptr<langgen::ast::Expression> parse_identifier(std::vector<langgen::lexer::Token>& tokens);
+		std::shared_ptr<langgen::ast::Expression> parse_identifier(langgen::parser::TokenStream& tokens);
 
-		std::shared_ptr<langgen::ast::Expression> parse_boolean_expression(std::vector<langgen::lexer::Token>& tokens);
+		std::shared_ptr<langgen::ast::Expression> parse_boolean_expression(langgen::parser::TokenStream& tokens);
 
-		std::shared_ptr<langgen::ast::Expression> parse_unary_expression(std::vector<langgen::lexer::Token>& tokens);
+		std::shared_ptr<langgen::ast::Expression> parse_unary_expression(langgen::parser::TokenStream& tokens);
 
-		std::shared_ptr<langgen::ast::Expression> parse_multiplicative_expression(std::vector<langgen::lexer::Token>& tokens);
+		/**
+		 * The binary operators, all left-associative, from the tightest to the loosest : `*` `/`, `+` `-`, `&&` `||`
+		 */
+		const langgen::parser::OperatorTable& get_operator_table();
 
-		std::shared_ptr<langgen::ast::Expression> parse_additive_expression(std::vector<langgen::lexer::Token>& tokens);
+		std::shared_ptr<langgen::ast::Expression> parse_binary_expression(langgen::parser::TokenStream& tokens);
 
-		std::shared_ptr<langgen::ast::Expression> parse_logical_expression(std::vector<langgen::lexer::Token>& tokens);
+		std::shared_ptr<langgen::ast::Statement> parse_assignation_expression(langgen::parser::TokenStream& tokens);
 
-		std::shared_ptr<langgen::ast::Expression> parse_binary_expression(std::vector<langgen::lexer::Token>& tokens);
-
-		std::shared_ptr<langgen::ast::Statement> parse_assignation_expression(std::vector<langgen::lexer::Token>& tokens);
-
-		std::shared_ptr<langgen::ast::Statement> parse_declaration_expression(std::vector<langgen::lexer::Token>& tokens);
+		std::shared_ptr<langgen::ast::Statement> parse_declaration_expression(langgen::parser::TokenStream& tokens);
 	}
 }
 
@@ -0,0 +1,85 @@
+#include "resolver.hpp"
+
+void tlang::resolver::resolve_identifier(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Statement> statement
+) {
+	std::shared_ptr<tlang::ast::Identifier> identifier = std::dynamic_pointer_cast<tlang::ast::Identifier>(statement);
+
+	std::optional<langgen::env::SlotAddress> address = langgen::resolver::lookup(resolver, identifier->get_name());
+	if(address.has_value()) {
+		identifier->set_address(address.value());
+	}
+}
+
+void tlang::resolver::resolve_unary_expression(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Statement> statement
+) {
+	std::shared_ptr<tlang::ast::UnaryExpression> unaryExpression = std::dynamic_pointer_cast<tlang::ast::UnaryExpression>(statement);
+
+	langgen::resolver::resolve_statement(resolver, unaryExpression->get_term());
+}
+
+void tlang::resolver::resolve_binary_expression(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Statement> statement
+) {
+	std::shared_ptr<tlang::ast::BinaryExpression> binaryExpression = std::dynamic_pointer_cast<tlang::ast::BinaryExpression>(statement);
+
+	langgen::resolver::resolve_statement(resolver, binaryExpression->get_left());
+	langgen::resolver::resolve_statement(resolver, binaryExpression->get_right());
+}
+
+void tlang::resolver::resolve_assignation_expression(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Statement> statement
+) {
+	std::shared_ptr<tlang::ast::AssignationExpression> assignationExpression = std::dynamic_pointer_cast<tlang::ast::AssignationExpression>(statement);
+
+	langgen::resolver::resolve_statement(resolver, assignationExpression->get_value());
+	tlang::resolver::resolve_identifier(resolver, assignationExpression->get_identifier());
+}
+
+void tlang::resolver::resolve_declaration_expression(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Statement> statement
+) {
+	std::shared_ptr<tlang::ast::DeclarationExpression> declarationExpression = std::dynamic_pointer_cast<tlang::ast::DeclarationExpression>(statement);
+
+	// The value is evaluated before the key is declared
+	langgen::resolver::resolve_statement(resolver, declarationExpression->get_value());
+
+	std::optional<size_t> slot = langgen::resolver::declare(resolver, declarationExpression->get_identifier()->get_name());
+	if(slot.has_value()) {
+		declarationExpression->set_slot(slot.value());
+	}
+}
+
+void setup_resolver(langgen::resolver::Resolver& resolver) {
+	langgen::resolver::setup_resolver(
+		resolver,
+		{
+			{
+				"DeclarationExpression",
+				&tlang::resolver::resolve_declaration_expression
+			},
+			{
+				"AssignationExpression",
+				&tlang::resolver::resolve_assignation_expression
+			},
+			{
+				"Identifier",
+				&tlang::resolver::resolve_identifier
+			},
+			{
+				"UnaryExpression",
+				&tlang::resolver::resolve_unary_expression
+			},
+			{
+				"BinaryExpression",
+				&tlang::resolver::resolve_binary_expression
+			},
+		}
+	);
+}
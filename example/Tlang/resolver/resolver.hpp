@@ -0,0 +1,34 @@
+#ifndef __T_RESOLVER__
+#define __T_RESOLVER__
+
+#include "../parser/ast.hpp"
+#include <AquIce/langgen/resolver.hpp>
+
+void setup_resolver(langgen::resolver::Resolver& resolver);
+
+namespace tlang {
+	namespace resolver {
+		void resolve_identifier(
+			langgen::resolver::Resolver& resolver,
+			std::shared_ptr<langgen::ast::Statement> statement
+		);
+		void resolve_unary_expression(
+			langgen::resolver::Resolver& resolver,
+			std::shared_ptr<langgen::ast::Statement> statement
+		);
+		void resolve_binary_expression(
+			langgen::resolver::Resolver& resolver,
+			std::shared_ptr<langgen::ast::Statement> statement
+		);
+		void resolve_assignation_expression(
+			langgen::resolver::Resolver& resolver,
+			std::shared_ptr<langgen::ast::Statement> statement
+		);
+		void resolve_declaration_expression(
+			langgen::resolver::Resolver& resolver,
+			std::shared_ptr<langgen::ast::Statement> statement
+		);
+	}
+}
+
+#endif // __T_RESOLVER__
@@ -0,0 +1,178 @@
+#include "vm.hpp"
+
+uint32_t tlang::vm::compile_identifier(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::Identifier> identifier = std::static_pointer_cast<tlang::ast::Identifier>(statement);
+
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+
+	std::optional<langgen::env::SlotAddress> address = identifier->get_address();
+	if(address.has_value()) {
+		langgen::vm::emit(compiler, langgen::vm::OP_GET_AT, reg, langgen::vm::add_address(compiler, address.value()));
+	} else {
+		langgen::vm::emit(compiler, langgen::vm::OP_GET, reg, langgen::vm::add_name(compiler, identifier->get_name()));
+	}
+	return reg;
+}
+
+uint32_t tlang::vm::compile_boolean_expression(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+	langgen::vm::emit(
+		compiler,
+		langgen::vm::OP_LOAD_CONSTANT,
+		reg,
+		langgen::vm::add_constant(
+			compiler,
+			langgen::values::Value::boolean(std::static_pointer_cast<tlang::ast::BooleanExpression>(statement)->value)
+		)
+	);
+	return reg;
+}
+
+uint32_t tlang::vm::compile_unary_expression(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::UnaryExpression> unaryExpression = std::static_pointer_cast<tlang::ast::UnaryExpression>(statement);
+
+	uint32_t term = langgen::vm::compile_statement(compiler, unaryExpression->get_term());
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+
+	langgen::vm::emit(
+		compiler,
+		langgen::vm::get_opcode(*compiler.vm, unaryExpression->get_operator_symbol()),
+		reg,
+		term
+	);
+	return reg;
+}
+
+uint32_t tlang::vm::compile_binary_expression(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::BinaryExpression> binaryExpression = std::static_pointer_cast<tlang::ast::BinaryExpression>(statement);
+
+	// Both operands are always evaluated, as in the interpreter
+	uint32_t left = langgen::vm::compile_statement(compiler, binaryExpression->get_left());
+	uint32_t right = langgen::vm::compile_statement(compiler, binaryExpression->get_right());
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+
+	langgen::vm::emit(
+		compiler,
+		langgen::vm::get_opcode(*compiler.vm, binaryExpression->get_operator_symbol()),
+		reg,
+		left,
+		right
+	);
+	return reg;
+}
+
+uint32_t tlang::vm::compile_assignation_expression(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::AssignationExpression> assignationExpression = std::static_pointer_cast<tlang::ast::AssignationExpression>(statement);
+
+	uint32_t value = langgen::vm::compile_statement(compiler, assignationExpression->get_value());
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+
+	std::optional<langgen::env::SlotAddress> address = assignationExpression->get_identifier()->get_address();
+	if(address.has_value()) {
+		langgen::vm::emit(compiler, langgen::vm::OP_SET_AT, reg, langgen::vm::add_address(compiler, address.value()), value);
+	} else {
+		langgen::vm::emit(compiler, langgen::vm::OP_SET, reg, langgen::vm::add_name(compiler, assignationExpression->get_identifier()->get_name()), value);
+	}
+	return reg;
+}
+
+uint32_t tlang::vm::compile_declaration_expression(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	std::shared_ptr<tlang::ast::DeclarationExpression> declarationExpression = std::static_pointer_cast<tlang::ast::DeclarationExpression>(statement);
+
+	uint32_t value = langgen::vm::compile_statement(compiler, declarationExpression->get_value());
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+
+	langgen::env::Properties properties(langgen::interpreter::get_env_schema(*compiler.interpreter));
+	properties.set("isMutable", declarationExpression->get_mutability() ? "true" : "false");
+
+	langgen::vm::emit(
+		compiler,
+		langgen::vm::OP_INIT,
+		reg,
+		langgen::vm::add_declaration(
+			compiler,
+			langgen::vm::Declaration{
+				declarationExpression->get_identifier()->get_name(),
+				declarationExpression->get_slot(),
+				properties
+			}
+		),
+		value
+	);
+	return reg;
+}
+
+/**
+ * Make a custom instruction applying an operation to the registers b and c
+ */
+static langgen::vm::OpcodeFunction binary_opcode(
+	langgen::values::Value (*operation)(const langgen::values::Value&, const langgen::values::Value&)
+) {
+	return [operation](langgen::vm::Frame& frame, const langgen::vm::Instruction& instruction) {
+		frame.registers[instruction.a] = operation(frame.registers[instruction.b], frame.registers[instruction.c]);
+	};
+}
+
+void setup_vm(langgen::vm::VM& vm) {
+	langgen::vm::setup_vm(
+		vm,
+		{
+			{
+				"DeclarationExpression",
+				&tlang::vm::compile_declaration_expression
+			},
+			{
+				"AssignationExpression",
+				&tlang::vm::compile_assignation_expression
+			},
+			{
+				"Identifier",
+				&tlang::vm::compile_identifier
+			},
+			{
+				"BooleanExpression",
+				&tlang::vm::compile_boolean_expression
+			},
+			{
+				"UnaryExpression",
+				&tlang::vm::compile_unary_expression
+			},
+			{
+				"BinaryExpression",
+				&tlang::vm::compile_binary_expression
+			},
+		},
+		{
+			{
+				"!",
+				[] (langgen::vm::Frame& frame, const langgen::vm::Instruction& instruction) {
+					frame.registers[instruction.a] = tlang::interpreter::logical_not(frame.registers[instruction.b]);
+				}
+			},
+			{ "+", binary_opcode(&tlang::interpreter::add) },
+			{ "-", binary_opcode(&tlang::interpreter::subtract) },
+			{ "*", binary_opcode(&tlang::interpreter::multiply) },
+			{ "/", binary_opcode(&tlang::interpreter::divide) },
+			{ "&&", binary_opcode(&tlang::interpreter::logical_and) },
+			{ "||", binary_opcode(&tlang::interpreter::logical_or) },
+		}
+	);
+}
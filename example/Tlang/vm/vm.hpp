@@ -0,0 +1,39 @@
+#ifndef __T_VM__
+#define __T_VM__
+
+#include "../parser/ast.hpp"
+#include "../interpreter/interpreter.hpp"
+#include <AquIce/langgen/vm.hpp>
+
+void setup_vm(langgen::vm::VM& vm);
+
+namespace tlang {
+	namespace vm {
+		uint32_t compile_identifier(
+			langgen::vm::Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		uint32_t compile_boolean_expression(
+			langgen::vm::Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		uint32_t compile_unary_expression(
+			langgen::vm::Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		uint32_t compile_binary_expression(
+			langgen::vm::Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		uint32_t compile_assignation_expression(
+			langgen::vm::Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+		uint32_t compile_declaration_expression(
+			langgen::vm::Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+	}
+}
+
+#endif // __T_VM__
@@ -46,13 +46,37 @@ int main(int argc, char** argv) {
 
 	std::cout << program->repr() << std::endl;
 
-	// * INTERPRETER
+	// * OPTIMIZER
 
 	langgen::interpreter::Interpreter interpreter;
 
 	setup_interpreter(interpreter);
 
-	std::unordered_map<std::string, std::string> results;
+	langgen::optimizer::Optimizer optimizer;
+
+	setup_optimizer(optimizer, interpreter);
+
+	langgen::optimizer::optimize(
+		optimizer,
+		program
+	);
+
+	std::cout << program->repr() << std::endl;
+
+	// * RESOLVER
+
+	langgen::resolver::Resolver resolver;
+
+	setup_resolver(resolver);
+
+	langgen::resolver::resolve(
+		resolver,
+		program
+	);
+
+	// * INTERPRETER
+
+	langgen::interpreter::ResultSink results = langgen::interpreter::ResultSink{langgen::interpreter::ResultPolicy::ORDERED};
 
 	langgen::interpreter::interpret(
 		interpreter,
@@ -60,8 +84,8 @@ int main(int argc, char** argv) {
 		program
 	);
 
-	for(const auto& [node, result] : results) {
-		std::cout << node << " -> " << result << std::endl;
+	for(const langgen::interpreter::StatementResult& result : results.results) {
+		std::cout << result.statement->repr() << " -> " << result.value.repr() << std::endl;
 	}
 
 	return 0;
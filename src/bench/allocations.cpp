@@ -0,0 +1,35 @@
+#include "suite.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// Every allocation of the benchmark goes through these replacements, the library included
+// as long as it is linked statically (a shared library may keep its own allocator)
+
+static size_t allocationCount = 0;
+static size_t allocatedByteCount = 0;
+
+void* operator new(size_t size) {
+	allocationCount++;
+	allocatedByteCount += size;
+	if(void* memory = std::malloc(size == 0 ? 1 : size)) {
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t size) noexcept {
+	std::free(memory);
+}
+
+size_t bench::allocations() {
+	return allocationCount;
+}
+
+size_t bench::allocated_bytes() {
+	return allocatedByteCount;
+}
@@ -0,0 +1,37 @@
+#include "suite.hpp"
+
+std::string bench::identifier(std::string prefix, size_t index) {
+	do {
+		prefix += static_cast<char>('a' + index % 26);
+		index /= 26;
+	} while(index != 0);
+	return prefix;
+}
+
+std::string bench::generate_source(size_t count, const std::function<std::string(size_t)>& line) {
+	std::string src;
+
+	for(size_t i = 0; i < count; i++) {
+		src += line(i);
+	}
+
+	return src;
+}
+
+std::string bench::generate_source_bytes(size_t bytes, const std::function<std::string(size_t)>& line) {
+	std::string src;
+	src.reserve(bytes + 64);
+
+	for(size_t i = 0; src.length() < bytes; i++) {
+		src += line(i);
+	}
+
+	return src;
+}
+
+double bench::parse_seconds(langgen::parser::Parser& parser, const std::vector<langgen::lexer::Token>& tokens) {
+	std::vector<langgen::lexer::Token> copy = tokens;
+	std::shared_ptr<langgen::ast::Scope> program = std::make_shared<langgen::ast::Scope>();
+
+	return bench::seconds([&]() { langgen::parser::parse(parser, program, copy); });
+}
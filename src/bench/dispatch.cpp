@@ -0,0 +1,97 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+// Top node dispatch benchmark
+// Usage: lg_bench_dispatch [statements] [kinds]
+// Parses statements of many kinds (`kNN <number>`, one top node per keyword), first trying every top node
+// in turn, then only the nodes declared to start with the next token by `set_first_tokens`.
+
+std::string keyword(size_t kind) {
+	return std::string("k") + static_cast<char>('0' + kind / 10) + static_cast<char>('0' + kind % 10);
+}
+
+void setup_lexer(langgen::lexer::Lexer& lexer, size_t kinds) {
+	std::vector<langgen::lexer::TokenType> tokenTypes;
+
+	for(size_t kind = 0; kind < kinds; kind++) {
+		tokenTypes.push_back(langgen::lexer::make_token_type(keyword(kind)));
+	}
+	tokenTypes.push_back(
+		langgen::lexer::make_token_type(
+			"NUMBER",
+			langgen::lexer::MatchTokenFunction([](std::string_view src) -> size_t {
+				size_t i = 0;
+				while(i < src.length() && isdigit(src.at(i))) {
+					i++;
+				}
+				return i;
+			})
+		)
+	);
+
+	langgen::lexer::setup_lexer(
+		lexer,
+		tokenTypes
+	);
+}
+
+void setup_parser(langgen::parser::Parser& parser, size_t kinds, bool predictive) {
+	langgen::parser::setup_parser(parser, {});
+	langgen::parser::demoteTopNode(parser, "NumberExpression");
+
+	for(size_t kind = 0; kind < kinds; kind++) {
+		langgen::lexer::TokenKind tokenKind = langgen::lexer::token_kind(keyword(kind));
+
+		langgen::parser::register_node(
+			parser,
+			keyword(kind),
+			langgen::parser::make_node(
+				[tokenKind](langgen::parser::TokenStream& tokens) -> std::shared_ptr<langgen::ast::Statement> {
+					if(peek(tokens).kind != tokenKind) {
+						return nullptr;
+					}
+					(void)eat(tokens);
+					return langgen::parser::parse_number_expression(tokens);
+				}
+			)
+		);
+
+		if(predictive) {
+			langgen::parser::set_first_tokens(parser, keyword(kind), { keyword(kind) });
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	size_t statements = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+	size_t kinds = argc > 2 ? std::min<size_t>(std::strtoull(argv[2], nullptr, 10), 100) : 60;
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer, kinds);
+
+	std::string src = bench::generate_source(statements, [&](size_t i) {
+		return keyword((i * 7919) % kinds) + " " + std::to_string(i % 1000) + "\n";
+	});
+
+	std::vector<langgen::lexer::Token> tokens;
+	langgen::lexer::lex(lexer, tokens, src);
+
+	langgen::parser::Parser trialParser;
+	setup_parser(trialParser, kinds, false);
+
+	langgen::parser::Parser predictiveParser;
+	setup_parser(predictiveParser, kinds, true);
+
+	double trialSeconds = bench::parse_seconds(trialParser, tokens);
+	double predictiveSeconds = bench::parse_seconds(predictiveParser, tokens);
+
+	std::cout << "dispatch	statements/s" << std::endl;
+	std::cout << "trial	" << statements / trialSeconds << std::endl;
+	std::cout << "predictive	" << statements / predictiveSeconds << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,90 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+#include "../../example/Tlang/core.hpp"
+
+// Node dispatch benchmark on the Tlang example grammar
+// Usage: lg_bench_evaluation [statements] [repetitions]
+// Evaluates a program of literal statements, each statement being a single node, so that
+// the measured time is dominated by the dispatch of `evaluate_value`.
+// `map_walk` is the previous dispatch, walking the evaluation functions and comparing `type()`.
+
+langgen::values::Value evaluate_value_map_walk(
+	langgen::interpreter::Interpreter& interpreter,
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
+) {
+	for(const auto& [nodeType, evaluateFn] : interpreter.nodeValueEvaluationFunctions) {
+		if(statement->type() == nodeType) {
+			return evaluateFn(interpreter, statement, env);
+		}
+	}
+	throw std::runtime_error("Trying to evaluate unknown statement " + statement->type());
+}
+
+std::string generate_source(size_t statements) {
+	const std::vector<std::string> literals = std::vector<std::string>({
+		"true",
+		"42",
+		"false",
+		".5",
+	});
+
+	return bench::generate_source(statements, [&](size_t i) { return literals.at(i % literals.size()) + "\n"; });
+}
+
+template <typename EvaluateFn>
+double evaluate_seconds(
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Scope> program,
+	size_t repetitions,
+	EvaluateFn evaluateFn
+) {
+	std::shared_ptr<langgen::env::Environment> env = std::make_shared<langgen::env::Environment>(
+		interpreter.envValuesProperties,
+		interpreter.validationRules
+	);
+
+	return bench::seconds([&]() {
+		for(size_t i = 0; i < repetitions; i++) {
+			for(const std::shared_ptr<langgen::ast::Statement>& statement : program->body) {
+				(void)evaluateFn(interpreter, statement, env);
+			}
+		}
+	});
+}
+
+int main(int argc, char** argv) {
+	size_t statements = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+	size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer);
+
+	std::vector<langgen::lexer::Token> tokens;
+	langgen::lexer::lex(lexer, tokens, generate_source(statements));
+
+	langgen::parser::Parser parser;
+	setup_parser(parser);
+
+	std::shared_ptr<langgen::ast::Scope> program = std::make_shared<langgen::ast::Scope>();
+	langgen::parser::parse(parser, program, tokens);
+
+	langgen::interpreter::Interpreter interpreter;
+	setup_interpreter(interpreter);
+
+	double mapWalkSeconds = evaluate_seconds(interpreter, program, repetitions, &evaluate_value_map_walk);
+	double tableSeconds = evaluate_seconds(interpreter, program, repetitions, &langgen::interpreter::evaluate_value);
+
+	double nodes = static_cast<double>(program->body.size() * repetitions);
+
+	std::cout << "dispatch\tnodes\tseconds\tnodes/s" << std::endl;
+	std::cout << "map_walk\t" << nodes << "\t" << mapWalkSeconds << "\t" << nodes / mapWalkSeconds << std::endl;
+	std::cout << "kind_table\t" << nodes << "\t" << tableSeconds << "\t" << nodes / tableSeconds << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,121 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+// Expression parser benchmark
+// Usage: lg_bench_expression [operands]
+// Parses a long chain of binary operations with grammars of 1 to 12 precedence levels, one operator per level,
+// with a recursive descent parser (one function call per level and per operand) and with `parse_expression`.
+
+const std::string OPERATORS = "|&=<+-*/%^~@";
+
+void setup_lexer(langgen::lexer::Lexer& lexer) {
+	std::vector<langgen::lexer::TokenType> tokenTypes;
+
+	for(char op : OPERATORS) {
+		tokenTypes.push_back(langgen::lexer::make_token_type("OPERATOR", std::string(1, op)));
+	}
+	tokenTypes.push_back(
+		langgen::lexer::make_token_type(
+			"NUMBER",
+			langgen::lexer::MatchTokenFunction([](std::string_view src) -> size_t {
+				size_t i = 0;
+				while(i < src.length() && isdigit(src.at(i))) {
+					i++;
+				}
+				return i;
+			})
+		)
+	);
+
+	langgen::lexer::setup_lexer(
+		lexer,
+		tokenTypes
+	);
+}
+
+// Only the parsing is measured, no node is built for the operations
+std::shared_ptr<langgen::ast::Expression> build_operation(
+	langgen::parser::TokenStream& tokens,
+	std::shared_ptr<langgen::ast::Expression> left,
+	const langgen::lexer::Token& op,
+	std::shared_ptr<langgen::ast::Expression> right
+) {
+	return left;
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_level(langgen::parser::TokenStream& tokens, size_t level, size_t levels) {
+	static const langgen::lexer::TokenKind OPERATOR = langgen::lexer::token_kind("OPERATOR");
+
+	if(level == levels) {
+		return langgen::parser::parse_number_expression(tokens);
+	}
+
+	std::shared_ptr<langgen::ast::Expression> left = parse_level(tokens, level + 1, levels);
+
+	while(peek(tokens).kind == OPERATOR && peek(tokens).value[0] == OPERATORS[level]) {
+		langgen::lexer::Token op = eat(tokens);
+		left = build_operation(tokens, left, op, parse_level(tokens, level + 1, levels));
+	}
+
+	return left;
+}
+
+std::string generate_source(size_t operands, size_t levels) {
+	return bench::generate_source(operands, [&](size_t i) {
+		return i == 0 ? std::string("1") : " " + std::string(1, OPERATORS[(i * 7) % levels]) + " " + std::to_string(i % 100);
+	});
+}
+
+int main(int argc, char** argv) {
+	size_t operands = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer);
+
+	std::cout << "levels	recursive (ms)	table (ms)" << std::endl;
+
+	for(size_t levels : { 1, 3, 6, 12 }) {
+		std::vector<langgen::lexer::Token> tokens;
+		langgen::lexer::lex(lexer, tokens, generate_source(operands, levels));
+
+		langgen::parser::OperatorTable table = langgen::parser::OperatorTable{
+			{},
+			[](langgen::parser::TokenStream& tokens) -> std::shared_ptr<langgen::ast::Statement> {
+				return langgen::parser::parse_number_expression(tokens);
+			}
+		};
+		for(size_t level = 0; level < levels; level++) {
+			table.binaryOperators.push_back(
+				langgen::parser::make_binary_operator(
+					"OPERATOR",
+					std::string(1, OPERATORS[level]),
+					static_cast<int>(level),
+					langgen::parser::Associativity::LEFT,
+					&build_operation
+				)
+			);
+		}
+
+		langgen::parser::TokenStream recursiveStream = langgen::parser::TokenStream{tokens};
+		double recursiveSeconds = bench::seconds([&]() { (void)parse_level(recursiveStream, 0, levels); });
+
+		langgen::parser::TokenStream tableStream = langgen::parser::TokenStream{tokens};
+		double tableSeconds = bench::seconds([&]() { (void)langgen::parser::parse_expression(table, tableStream); });
+
+		if(recursiveStream.position != tableStream.position) {
+			std::cerr << "The parsers stopped at different tokens for " << levels << " levels" << std::endl;
+			return 1;
+		}
+
+		std::cout
+			<< levels << "\t"
+			<< recursiveSeconds * 1000 << "\t"
+			<< tableSeconds * 1000 << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+#include "../../example/Tlang/core.hpp"
+
+// Edit latency benchmark on the Tlang example grammar
+// Usage: lg_bench_incremental [max_declarations] [edits]
+// For sources of growing size, replaces a digit in the middle of the source and measures
+// a full `lex` + `parse` against `relex` + `reparse`, checking both give the same program.
+// Then measures `relex` + `reparse` for edits changing the length of the source (inserting and removing a digit),
+// which also shift the offsets of the following tokens.
+// Finally checks that reparsing a program parsed in an arena does not grow the arena.
+
+std::string generate_source(size_t declarations) {
+	return bench::generate_source(declarations, [](size_t i) {
+		return
+			"let " + bench::identifier("x", i) + ": number = 1 * 2 - 3 / 4 + 5 // declaration\n" +
+			bench::identifier("x", i) + " = !true && false || true\n";
+	});
+}
+
+std::shared_ptr<langgen::ast::Scope> parse_program(
+	langgen::parser::Parser& parser,
+	std::vector<langgen::lexer::Token>& tokens
+) {
+	std::shared_ptr<langgen::ast::Scope> program = std::make_shared<langgen::ast::Scope>();
+	// Parsed from a stream, which keeps the tokens to reparse from
+	langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+	langgen::parser::parse(parser, program, stream);
+	return program;
+}
+
+int main(int argc, char** argv) {
+	size_t maxDeclarations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64000;
+	size_t edits = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer);
+
+	langgen::parser::Parser parser;
+	setup_parser(parser);
+
+	std::cout << "declarations	bytes	full (ms)	incremental (ms)	speedup	incremental resizing (ms)" << std::endl;
+
+	for(size_t declarations = 1000; declarations <= maxDeclarations; declarations *= 4) {
+		std::string src = generate_source(declarations);
+
+		std::vector<langgen::lexer::Token> tokens;
+		langgen::lexer::lex(lexer, tokens, src);
+		std::shared_ptr<langgen::ast::Scope> program = parse_program(parser, tokens);
+
+		// The digit of the middle declaration, replaced by another one at every edit
+		size_t offset = src.find("= 1", src.length() / 2) + 2;
+
+		double fullSeconds = 0;
+		double incrementalSeconds = 0;
+
+		for(size_t i = 0; i < edits; i++) {
+			src[offset] = static_cast<char>('1' + i % 9);
+
+			std::vector<langgen::lexer::Token> fullTokens;
+			std::shared_ptr<langgen::ast::Scope> fullProgram;
+			fullSeconds += bench::seconds([&]() {
+				langgen::lexer::lex(lexer, fullTokens, src);
+				fullProgram = parse_program(parser, fullTokens);
+			});
+
+			incrementalSeconds += bench::seconds([&]() {
+				langgen::lexer::Edit tokenEdit = langgen::lexer::relex(lexer, tokens, src, langgen::lexer::Edit{offset, 1, 1});
+				langgen::parser::reparse(parser, program, tokens, tokenEdit);
+			});
+
+			if(i == edits - 1 && fullProgram->repr() != program->repr()) {
+				std::cerr << "reparse gives a different program for " << declarations << " declarations" << std::endl;
+				return 1;
+			}
+		}
+
+		double resizingSeconds = 0;
+
+		for(size_t i = 0; i < edits; i++) {
+			bool insert = i % 2 == 0;
+			if(insert) {
+				src.insert(offset + 1, "0");
+			} else {
+				src.erase(offset + 1, 1);
+			}
+
+			resizingSeconds += bench::seconds([&]() {
+				langgen::lexer::Edit tokenEdit = langgen::lexer::relex(
+					lexer,
+					tokens,
+					src,
+					langgen::lexer::Edit{offset + 1, insert ? 0u : 1u, insert ? 1u : 0u}
+				);
+				langgen::parser::reparse(parser, program, tokens, tokenEdit);
+			});
+		}
+
+		std::cout
+			<< declarations << "\t"
+			<< src.length() << "\t"
+			<< fullSeconds * 1000 / edits << "\t"
+			<< incrementalSeconds * 1000 / edits << "\t"
+			<< fullSeconds / incrementalSeconds << "\t"
+			<< resizingSeconds * 1000 / edits << std::endl;
+	}
+
+	// The arena never reuses memory, reparsed statements must not be allocated in it
+	parser.useArena = true;
+
+	std::string src = generate_source(1000);
+	std::vector<langgen::lexer::Token> tokens;
+	langgen::lexer::lex(lexer, tokens, src);
+	std::shared_ptr<langgen::ast::Scope> program = parse_program(parser, tokens);
+	size_t capacity = program->arena->capacity();
+
+	size_t offset = src.find("= 1", src.length() / 2) + 2;
+	for(size_t i = 0; i < edits * 100; i++) {
+		src[offset] = static_cast<char>('1' + i % 9);
+		langgen::lexer::Edit tokenEdit = langgen::lexer::relex(lexer, tokens, src, langgen::lexer::Edit{offset, 1, 1});
+		langgen::parser::reparse(parser, program, tokens, tokenEdit);
+	}
+
+	std::cout << "arena capacity (bytes)	after parse " << capacity << "	after " << edits * 100 << " edits " << program->arena->capacity() << std::endl;
+
+	if(program->arena->capacity() != capacity) {
+		std::cerr << "reparse grows the arena of the program" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,85 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+// Lexer throughput benchmark
+// Usage: lg_bench_lexer [max_bytes] [time_budget_seconds]
+// Lexes sources of 1 KB, 10 KB, ... up to `max_bytes` (100 MB by default) and reports
+// how the throughput scales. Sizes are skipped once a run exceeds the time budget.
+
+void setup_lexer(langgen::lexer::Lexer& lexer) {
+	std::vector<langgen::lexer::TokenType> tokenTypes = std::vector<langgen::lexer::TokenType>({
+		langgen::lexer::make_token_type("("),
+		langgen::lexer::make_token_type(")"),
+		langgen::lexer::make_token_type("OPERATOR", "+"),
+		langgen::lexer::make_token_type("OPERATOR", "-"),
+		langgen::lexer::make_token_type("OPERATOR", "*"),
+		langgen::lexer::make_token_type("OPERATOR", "/"),
+		langgen::lexer::make_token_type("OPERATOR", "&&"),
+		langgen::lexer::make_token_type("OPERATOR", "||"),
+		langgen::lexer::make_token_type("UNARY_OPERATOR", "!"),
+		langgen::lexer::make_token_type("BOOL", "true"),
+		langgen::lexer::make_token_type("BOOL", "false"),
+		langgen::lexer::make_token_type(
+			"NUMBER",
+			[lexer](std::string_view src) -> size_t {
+				size_t i = 0;
+				while(i < src.length() && (isdigit(src.at(i)) || src.at(i) == lexer.decimalSeparator)) {
+					i++;
+				}
+				return i;
+			}
+		)
+	});
+
+	langgen::lexer::setup_lexer(
+		lexer,
+		tokenTypes
+	);
+}
+
+std::string generate_source(size_t size) {
+	const std::vector<std::string> lines = std::vector<std::string>({
+		"3 + 100 * .2 / 1 - 2\n",
+		"(3 + 100 * .2) / (1 - 2) // trailing comment\n",
+		"\ttrue && false || !false\n",
+		"/* multi\n   line comment */ 42 * (7 - 1)\n",
+	});
+
+	return bench::generate_source_bytes(size, [&](size_t i) { return lines.at(i % lines.size()); });
+}
+
+int main(int argc, char** argv) {
+	size_t maxBytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100 * 1000 * 1000;
+	double timeBudget = argc > 2 ? std::strtod(argv[2], nullptr) : 10;
+
+	langgen::lexer::Lexer lexer;
+
+	setup_lexer(lexer);
+
+	std::cout << "bytes\ttokens\tseconds\tMB/s\ttokens/s" << std::endl;
+
+	for(size_t size = 1000; size <= maxBytes; size *= 10) {
+		std::string src = generate_source(size);
+		std::vector<langgen::lexer::Token> tokens;
+
+		double seconds = bench::seconds([&]() { langgen::lexer::lex(lexer, tokens, src); });
+
+		std::cout
+			<< src.length() << "\t"
+			<< tokens.size() << "\t"
+			<< seconds << "\t"
+			<< (src.length() / 1e6) / seconds << "\t"
+			<< tokens.size() / seconds << std::endl;
+
+		if(seconds > timeBudget) {
+			std::cout << "# time budget exceeded, skipping larger sizes" << std::endl;
+			break;
+		}
+	}
+
+	return 0;
+}
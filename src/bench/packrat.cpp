@@ -0,0 +1,123 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+// Packrat parsing benchmark, on a backtracking grammar
+// Usage: lg_bench_packrat [max_depth]
+//   Sum  -> Term "+" Sum | Term
+//   Term -> "(" Sum ")" | NUMBER
+// Both alternatives of Sum start with Term, which is parsed again after backtracking : without memoization,
+// parsing nested parentheses is exponential in their depth. Memoizing Sum and Term makes it linear.
+
+void setup_lexer(langgen::lexer::Lexer& lexer) {
+	std::vector<langgen::lexer::TokenType> tokenTypes = std::vector<langgen::lexer::TokenType>({
+		langgen::lexer::make_token_type("("),
+		langgen::lexer::make_token_type(")"),
+		langgen::lexer::make_token_type("+"),
+		langgen::lexer::make_token_type(
+			"NUMBER",
+			langgen::lexer::MatchTokenFunction([](std::string_view src) -> size_t {
+				size_t i = 0;
+				while(i < src.length() && isdigit(src.at(i))) {
+					i++;
+				}
+				return i;
+			})
+		)
+	});
+
+	langgen::lexer::setup_lexer(
+		lexer,
+		tokenTypes
+	);
+}
+
+std::shared_ptr<langgen::ast::Statement> parse_sum(langgen::parser::TokenStream& tokens) {
+	static const langgen::lexer::TokenKind PLUS = langgen::lexer::token_kind("+");
+
+	size_t start = langgen::parser::mark(tokens);
+
+	std::shared_ptr<langgen::ast::Statement> left = langgen::parser::parse_node(tokens, "Term");
+	if(left != nullptr && peek(tokens).kind == PLUS) {
+		(void)eat(tokens);
+		std::shared_ptr<langgen::ast::Statement> right = langgen::parser::parse_node(tokens, "Sum");
+		if(right != nullptr) {
+			// Only the parsing is measured, no node is built for the sum
+			return left;
+		}
+	}
+
+	langgen::parser::reset(tokens, start);
+	return langgen::parser::parse_node(tokens, "Term");
+}
+
+std::shared_ptr<langgen::ast::Statement> parse_term(langgen::parser::TokenStream& tokens) {
+	static const langgen::lexer::TokenKind OPEN = langgen::lexer::token_kind("(");
+	static const langgen::lexer::TokenKind CLOSE = langgen::lexer::token_kind(")");
+
+	size_t start = langgen::parser::mark(tokens);
+
+	if(peek(tokens).kind == OPEN) {
+		(void)eat(tokens);
+		std::shared_ptr<langgen::ast::Statement> sum = langgen::parser::parse_node(tokens, "Sum");
+		if(sum != nullptr && peek(tokens).kind == CLOSE) {
+			(void)eat(tokens);
+			return sum;
+		}
+		langgen::parser::reset(tokens, start);
+		return nullptr;
+	}
+
+	return langgen::parser::parse_number_expression(tokens);
+}
+
+void setup_parser(langgen::parser::Parser& parser, bool memoize) {
+	langgen::parser::setup_parser(
+		parser,
+		{
+			{
+				"Sum",
+				langgen::parser::make_node(&parse_sum, true, memoize)
+			},
+			{
+				"Term",
+				langgen::parser::make_node(&parse_term, false, memoize)
+			},
+		}
+	);
+
+	langgen::parser::demoteTopNode(parser, "NumberExpression");
+}
+
+int main(int argc, char** argv) {
+	size_t maxDepth = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20;
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer);
+
+	langgen::parser::Parser plainParser;
+	setup_parser(plainParser, false);
+
+	langgen::parser::Parser packratParser;
+	setup_parser(packratParser, true);
+
+	std::cout << "depth	tokens	plain (ms)	packrat (ms)" << std::endl;
+
+	for(size_t depth = 4; depth <= maxDepth; depth += 4) {
+		std::string src = std::string(depth, '(') + "1" + std::string(depth, ')') + " + 2";
+
+		std::vector<langgen::lexer::Token> tokens;
+		langgen::lexer::lex(lexer, tokens, src);
+
+		std::cout
+			<< depth << "\t"
+			<< tokens.size() << "\t"
+			<< bench::parse_seconds(plainParser, tokens) * 1000 << "\t"
+			<< bench::parse_seconds(packratParser, tokens) * 1000 << std::endl;
+	}
+
+	return 0;
+}
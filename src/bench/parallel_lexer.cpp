@@ -0,0 +1,108 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "suite.hpp"
+
+// Parallel lexer scaling benchmark
+// Usage: lg_bench_parallel_lexer [bytes] [max_threads]
+// Lexes the same source (100 MB by default) with `lex`, then with `lex_parallel` on 1 to
+// `max_threads` threads (every hardware thread by default), and checks the tokens are identical.
+
+void setup_lexer(langgen::lexer::Lexer& lexer) {
+	std::vector<langgen::lexer::TokenType> tokenTypes = std::vector<langgen::lexer::TokenType>({
+		langgen::lexer::make_token_type("("),
+		langgen::lexer::make_token_type(")"),
+		langgen::lexer::make_token_type("OPERATOR", "+"),
+		langgen::lexer::make_token_type("OPERATOR", "-"),
+		langgen::lexer::make_token_type("OPERATOR", "*"),
+		langgen::lexer::make_token_type("OPERATOR", "/"),
+		langgen::lexer::make_token_type("OPERATOR", "&&"),
+		langgen::lexer::make_token_type("OPERATOR", "||"),
+		langgen::lexer::make_token_type("UNARY_OPERATOR", "!"),
+		langgen::lexer::make_token_type("BOOL", "true"),
+		langgen::lexer::make_token_type("BOOL", "false"),
+		langgen::lexer::make_token_type(
+			"NUMBER",
+			[lexer](std::string_view src) -> size_t {
+				size_t i = 0;
+				while(i < src.length() && (isdigit(src.at(i)) || src.at(i) == lexer.decimalSeparator)) {
+					i++;
+				}
+				return i;
+			}
+		)
+	});
+
+	langgen::lexer::setup_lexer(
+		lexer,
+		tokenTypes
+	);
+}
+
+std::string generate_source(size_t size) {
+	const std::vector<std::string> lines = std::vector<std::string>({
+		"3 + 100 * .2 / 1 - 2\n",
+		"(3 + 100 * .2) / (1 - 2) // trailing comment\n",
+		"\ttrue && false || !false\n",
+		"/* multi\n   line comment */ 42 * (7 - 1)\n",
+	});
+
+	return bench::generate_source_bytes(size, [&](size_t i) { return lines.at(i % lines.size()); });
+}
+
+bool same_tokens(const std::vector<langgen::lexer::Token>& left, const std::vector<langgen::lexer::Token>& right) {
+	if(left.size() != right.size()) {
+		return false;
+	}
+	for(size_t i = 0; i < left.size(); i++) {
+		if(left[i].kind != right[i].kind || left[i].value != right[i].value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	size_t bytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100 * 1000 * 1000;
+	size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+	langgen::lexer::Lexer lexer;
+
+	setup_lexer(lexer);
+
+	std::string src = generate_source(bytes);
+
+	std::vector<langgen::lexer::Token> sequentialTokens;
+
+	double sequentialSeconds = bench::seconds([&]() { langgen::lexer::lex(lexer, sequentialTokens, src); });
+
+	std::cout << "threads	tokens	seconds	MB/s	speedup" << std::endl;
+	std::cout << "sequential	" << sequentialTokens.size() << "	" << sequentialSeconds << "	" << (src.length() / 1e6) / sequentialSeconds << "	1" << std::endl;
+
+	for(size_t threads = 1; threads <= maxThreads; threads *= 2) {
+		std::vector<langgen::lexer::Token> tokens;
+
+		double seconds = bench::seconds([&]() { langgen::lexer::lex_parallel(lexer, tokens, src, threads); });
+
+		if(!same_tokens(sequentialTokens, tokens)) {
+			std::cerr << "lex_parallel on " << threads << " threads gives different tokens" << std::endl;
+			return 1;
+		}
+
+		std::cout
+			<< threads << "\t"
+			<< tokens.size() << "\t"
+			<< seconds << "\t"
+			<< (src.length() / 1e6) / seconds << "\t"
+			<< sequentialSeconds / seconds << std::endl;
+
+		if(threads < maxThreads && threads * 2 > maxThreads) {
+			threads = maxThreads / 2;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,290 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <AquIce/langgen/grammar.hpp>
+
+#include "suite.hpp"
+
+// Static grammar benchmark
+// Usage: lg_bench_static_grammar [operations] [repetitions]
+// Lexes, parses and evaluates chains of arithmetic operations with the same grammar declared twice :
+// through the runtime API (`std::function` tables) and as types (`StaticLexer`, `StaticParser`, `StaticInterpreter`).
+// Both share the node classes and the parsing functions, only the dispatch differs.
+
+class Operation : public langgen::ast::Expression {
+public:
+	Operation(std::shared_ptr<langgen::ast::Expression> left, char op, std::shared_ptr<langgen::ast::Expression> right) {
+		this->left = left;
+		this->op = op;
+		this->right = right;
+	}
+
+	virtual std::string type() override {
+		return "Operation";
+	}
+
+	std::shared_ptr<langgen::ast::Expression> left;
+	char op;
+	std::shared_ptr<langgen::ast::Expression> right;
+};
+
+double apply(char op, double left, double right) {
+	switch(op) {
+		case '+': return left + right;
+		case '-': return left - right;
+		case '*': return left * right;
+		default: return right == 0 ? 0 : left / right;
+	}
+}
+
+size_t match_number(std::string_view src) {
+	size_t i = 0;
+	while(i < src.length() && isdigit(src.at(i))) {
+		i++;
+	}
+	return i;
+}
+
+#pragma region Parsing functions
+
+const langgen::lexer::TokenKind OPERATOR = langgen::lexer::token_kind("OPERATOR");
+
+std::shared_ptr<langgen::ast::Expression> parse_product(langgen::parser::TokenStream& tokens) {
+	std::shared_ptr<langgen::ast::Expression> left = langgen::parser::parse_number_expression(tokens);
+
+	while(left != nullptr && peek(tokens).kind == OPERATOR && (peek(tokens).value == "*" || peek(tokens).value == "/")) {
+		char op = eat(tokens).value[0];
+		left = langgen::parser::make_statement<Operation>(tokens, left, op, langgen::parser::parse_number_expression(tokens));
+	}
+
+	return left;
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_sum(langgen::parser::TokenStream& tokens) {
+	std::shared_ptr<langgen::ast::Expression> left = parse_product(tokens);
+
+	while(left != nullptr && peek(tokens).kind == OPERATOR && (peek(tokens).value == "+" || peek(tokens).value == "-")) {
+		char op = eat(tokens).value[0];
+		left = langgen::parser::make_statement<Operation>(tokens, left, op, parse_product(tokens));
+	}
+
+	return left;
+}
+
+#pragma endregion
+
+#pragma region Runtime grammar
+
+void setup_lexer(langgen::lexer::Lexer& lexer) {
+	langgen::lexer::setup_lexer(
+		lexer,
+		std::vector<langgen::lexer::TokenType>({
+			langgen::lexer::make_token_type("OPERATOR", "+"),
+			langgen::lexer::make_token_type("OPERATOR", "-"),
+			langgen::lexer::make_token_type("OPERATOR", "*"),
+			langgen::lexer::make_token_type("OPERATOR", "/"),
+			langgen::lexer::make_token_type("NUMBER", langgen::lexer::MatchTokenFunction(&match_number)),
+		})
+	);
+}
+
+void setup_parser(langgen::parser::Parser& parser) {
+	langgen::parser::setup_parser(
+		parser,
+		{
+			{
+				"Sum",
+				langgen::parser::make_node(&parse_sum)
+			},
+		}
+	);
+	langgen::parser::demoteTopNode(parser, "NumberExpression");
+}
+
+void setup_interpreter(langgen::interpreter::Interpreter& interpreter) {
+	langgen::interpreter::setup_interpreter(
+		interpreter,
+		std::unordered_map<std::string, langgen::interpreter::ParseStatementFunction>(),
+		std::vector<std::string>(),
+		std::vector<langgen::env::EnvValidationRule>(),
+		std::unordered_map<std::string, langgen::interpreter::EvaluateValueFunction>({
+			{
+				"Operation",
+				[](
+					langgen::interpreter::Interpreter& interpreter,
+					const std::shared_ptr<langgen::ast::Statement>& statement,
+					const std::shared_ptr<langgen::env::Environment>& env
+				) -> langgen::values::Value {
+					Operation& operation = static_cast<Operation&>(*statement);
+					return langgen::values::Value::number(apply(
+						operation.op,
+						langgen::interpreter::evaluate_value(interpreter, operation.left, env).get_number(),
+						langgen::interpreter::evaluate_value(interpreter, operation.right, env).get_number()
+					));
+				}
+			},
+		})
+	);
+}
+
+#pragma endregion
+
+#pragma region Static grammar
+
+struct Plus {
+	static constexpr std::string_view name = "OPERATOR";
+	static constexpr std::string_view literal = "+";
+};
+struct Minus {
+	static constexpr std::string_view name = "OPERATOR";
+	static constexpr std::string_view literal = "-";
+};
+struct Times {
+	static constexpr std::string_view name = "OPERATOR";
+	static constexpr std::string_view literal = "*";
+};
+struct Divide {
+	static constexpr std::string_view name = "OPERATOR";
+	static constexpr std::string_view literal = "/";
+};
+struct Number {
+	static constexpr std::string_view name = "NUMBER";
+	static size_t match(std::string_view src) {
+		return match_number(src);
+	}
+};
+
+struct Sum {
+	static constexpr std::string_view key = "Sum";
+	static std::shared_ptr<langgen::ast::Statement> parse(langgen::parser::TokenStream& tokens) {
+		return parse_sum(tokens);
+	}
+};
+
+struct EvaluateOperation {
+	static constexpr std::string_view type = "Operation";
+	template <typename Interpreter>
+	static langgen::values::Value evaluate(
+		const std::shared_ptr<langgen::ast::Statement>& statement,
+		const std::shared_ptr<langgen::env::Environment>& env
+	) {
+		Operation& operation = langgen::grammar::node_as<Operation>(statement);
+		return langgen::values::Value::number(apply(
+			operation.op,
+			Interpreter::evaluate(operation.left, env).get_number(),
+			Interpreter::evaluate(operation.right, env).get_number()
+		));
+	}
+};
+struct EvaluateNumber {
+	static constexpr std::string_view type = "NumberExpression";
+	template <typename Interpreter>
+	static langgen::values::Value evaluate(
+		const std::shared_ptr<langgen::ast::Statement>& statement,
+		const std::shared_ptr<langgen::env::Environment>& env
+	) {
+		return langgen::values::Value::number(langgen::grammar::node_as<langgen::ast::NumberExpression>(statement).value);
+	}
+};
+
+typedef langgen::grammar::StaticLexer<langgen::grammar::DefaultLexerConfig, Plus, Minus, Times, Divide, Number> StaticLexer;
+typedef langgen::grammar::StaticParser<Sum> StaticParser;
+typedef langgen::grammar::StaticInterpreter<EvaluateOperation, EvaluateNumber> StaticInterpreter;
+
+#pragma endregion
+
+std::string generate_source(size_t operations) {
+	const std::string operators = "+*-/";
+	return bench::generate_source(operations + 1, [&](size_t i) {
+		if(i == 0) {
+			return std::string("1");
+		}
+		return
+			" " + std::string(1, operators[i % operators.length()]) + " " + std::to_string(i % 97 + 1) +
+			(i % 64 == 0 ? "\n" + std::to_string(i % 9 + 1) : "");
+	});
+}
+
+typedef struct PhaseTimes {
+	double lex = 0;
+	double parse = 0;
+	double evaluate = 0;
+	double result = 0;
+} PhaseTimes;
+
+template <typename LexFn, typename ParseFn, typename EvaluateFn>
+PhaseTimes run(const std::string& src, size_t repetitions, LexFn lexFn, ParseFn parseFn, EvaluateFn evaluateFn) {
+	PhaseTimes times;
+
+	for(size_t i = 0; i < repetitions; i++) {
+		std::vector<langgen::lexer::Token> tokens;
+		std::shared_ptr<langgen::ast::Scope> program = std::make_shared<langgen::ast::Scope>();
+
+		times.lex += bench::seconds([&]() { lexFn(tokens, src); }) * 1000 / repetitions;
+		times.parse += bench::seconds([&]() { parseFn(program, tokens); }) * 1000 / repetitions;
+		times.evaluate += bench::seconds([&]() { times.result = evaluateFn(program); }) * 1000 / repetitions;
+	}
+
+	return times;
+}
+
+int main(int argc, char** argv) {
+	size_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+	size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+
+	std::string src = generate_source(operations);
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer);
+
+	langgen::parser::Parser parser;
+	setup_parser(parser);
+
+	langgen::interpreter::Interpreter interpreter;
+	setup_interpreter(interpreter);
+
+	std::shared_ptr<langgen::env::Environment> env = std::make_shared<langgen::env::Environment>(
+		langgen::interpreter::get_env_schema(interpreter)
+	);
+
+	PhaseTimes runtime = run(
+		src,
+		repetitions,
+		[&](std::vector<langgen::lexer::Token>& tokens, const std::string& src) { langgen::lexer::lex(lexer, tokens, src); },
+		[&](std::shared_ptr<langgen::ast::Scope> program, std::vector<langgen::lexer::Token>& tokens) { langgen::parser::parse(parser, program, tokens); },
+		[&](std::shared_ptr<langgen::ast::Scope> program) {
+			double sum = 0;
+			for(const std::shared_ptr<langgen::ast::Statement>& statement : program->body) {
+				sum += langgen::interpreter::evaluate_value(interpreter, statement, env).get_number();
+			}
+			return sum;
+		}
+	);
+
+	PhaseTimes compiled = run(
+		src,
+		repetitions,
+		[](std::vector<langgen::lexer::Token>& tokens, const std::string& src) { StaticLexer::lex(tokens, src); },
+		[](std::shared_ptr<langgen::ast::Scope> program, std::vector<langgen::lexer::Token>& tokens) { StaticParser::parse(program, tokens); },
+		[&](std::shared_ptr<langgen::ast::Scope> program) {
+			double sum = 0;
+			for(const std::shared_ptr<langgen::ast::Statement>& statement : program->body) {
+				sum += StaticInterpreter::evaluate(statement, env).get_number();
+			}
+			return sum;
+		}
+	);
+
+	if(runtime.result != compiled.result) {
+		std::cerr << "The grammars give different results" << std::endl;
+		return 1;
+	}
+
+	std::cout << "grammar	lex (ms)	parse (ms)	evaluate (ms)" << std::endl;
+	std::cout << "runtime	" << runtime.lex << "\t" << runtime.parse << "\t" << runtime.evaluate << std::endl;
+	std::cout << "static	" << compiled.lex << "\t" << compiled.parse << "\t" << compiled.evaluate << std::endl;
+
+	return 0;
+}
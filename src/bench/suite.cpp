@@ -0,0 +1,155 @@
+#include "suite.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+typedef struct Phase {
+	double seconds = std::numeric_limits<double>::infinity();
+	size_t allocations = 0;
+	size_t allocatedBytes = 0;
+} Phase;
+
+template <typename Fn>
+static void measure(Phase& phase, Fn fn) {
+	size_t startAllocations = bench::allocations();
+	size_t startBytes = bench::allocated_bytes();
+
+	double seconds = bench::seconds(fn);
+
+	// The fastest run is kept, the allocations do not change between runs
+	if(seconds < phase.seconds) {
+		phase.seconds = seconds;
+	}
+	phase.allocations = bench::allocations() - startAllocations;
+	phase.allocatedBytes = bench::allocated_bytes() - startBytes;
+}
+
+static void print_phase(const Phase& phase, const std::string& rateName, size_t count) {
+	std::cout
+		<< "{\"seconds\":" << phase.seconds
+		<< ",\"" << rateName << "\":" << static_cast<double>(count) / phase.seconds
+		<< ",\"allocations\":" << phase.allocations
+		<< ",\"allocated_bytes\":" << phase.allocatedBytes
+		<< "}";
+}
+
+void bench::read_arguments(int argc, char** argv, size_t& size, size_t& repetitions) {
+	size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+	repetitions = argc > 2 ? std::max<size_t>(std::strtoull(argv[2], nullptr, 10), 1) : 5;
+}
+
+static const size_t EXPRESSION_OPERANDS = 64;
+static const size_t NESTING_DEPTH = 256;
+static const size_t COMMENTED_OPERANDS = 8;
+
+// Numbers joined by arithmetic operators, in groups joined by logical operators to booleans
+static std::string expression(size_t operands) {
+	const std::vector<std::string> arithmeticOperators = std::vector<std::string>({ "+", "*", "-", "/" });
+
+	std::string src;
+
+	for(size_t i = 0; i < operands; i++) {
+		if(i > 0) {
+			size_t group = (i - 1) % 6;
+			src += " " + (group < 4 ? arithmeticOperators.at(group) : std::string(i % 4 < 2 ? "&&" : "||")) + " ";
+		}
+		src += i % 6 == 5 ? std::string(i % 12 == 5 ? "!false" : "true") : std::to_string(i % 9 + 1);
+	}
+
+	return src;
+}
+
+std::vector<bench::Corpus> bench::expression_corpora(size_t size) {
+	bench::Corpus longExpressions = bench::Corpus{ "long_expressions", "" };
+	for(size_t i = 0; i < std::max<size_t>(size / EXPRESSION_OPERANDS, 1); i++) {
+		longExpressions.src += expression(EXPRESSION_OPERANDS) + "\n";
+	}
+
+	// Each chain nests its binary expressions `NESTING_DEPTH` deep
+	bench::Corpus deepNesting = bench::Corpus{ "deep_nesting", "" };
+	for(size_t i = 0; i < std::max<size_t>(size / NESTING_DEPTH, 1); i++) {
+		deepNesting.src += "1";
+		for(size_t j = 1; j < NESTING_DEPTH; j++) {
+			deepNesting.src += " + 1";
+		}
+		deepNesting.src += "\n";
+	}
+
+	bench::Corpus commentHeavy = bench::Corpus{ "comment_heavy", "" };
+	for(size_t i = 0; i < std::max<size_t>(size / COMMENTED_OPERANDS, 1); i++) {
+		commentHeavy.src +=
+			"// Statement " + std::to_string(i) + ", with a single line comment\n"
+			"/*\n"
+			" * And a multi-line comment,\n"
+			" * longer than the statement itself\n"
+			" */\n" +
+			expression(COMMENTED_OPERANDS) + " // and a trailing comment\n";
+	}
+
+	return std::vector<bench::Corpus>({ longExpressions, deepNesting, commentHeavy });
+}
+
+int bench::run_suite(const bench::Grammar& grammar, const std::vector<bench::Corpus>& corpora, size_t size, size_t repetitions) {
+	langgen::lexer::Lexer lexer;
+	grammar.setupLexer(lexer);
+
+	langgen::parser::Parser parser;
+	grammar.setupParser(parser);
+
+	langgen::interpreter::Interpreter interpreter;
+	grammar.setupInterpreter(interpreter);
+
+	for(const bench::Corpus& corpus : corpora) {
+		Phase lexPhase;
+		Phase parsePhase;
+		Phase interpretPhase;
+		size_t tokenCount = 0;
+		size_t nodeCount = 0;
+		size_t evaluationCount = 0;
+
+		try {
+			for(size_t i = 0; i < repetitions; i++) {
+				std::vector<langgen::lexer::Token> tokens;
+				std::shared_ptr<langgen::ast::Scope> program = std::make_shared<langgen::ast::Scope>();
+				langgen::interpreter::ResultSink sink;
+
+				measure(lexPhase, [&]() { langgen::lexer::lex(lexer, tokens, corpus.src); });
+				tokenCount = tokens.size();
+
+				measure(parsePhase, [&]() { langgen::parser::parse(parser, program, tokens); });
+
+				measure(interpretPhase, [&]() { langgen::interpreter::interpret(interpreter, sink, program); });
+
+				nodeCount = 0;
+				evaluationCount = 0;
+				for(const std::shared_ptr<langgen::ast::Statement>& statement : program->body) {
+					nodeCount += grammar.countNodes(statement);
+					evaluationCount += grammar.countEvaluations(statement);
+				}
+			}
+		} catch(const std::exception& e) {
+			std::cerr << grammar.name << " " << corpus.name << ": " << e.what() << std::endl;
+			return 1;
+		}
+
+		std::cout
+			<< "{\"grammar\":\"" << grammar.name << "\""
+			<< ",\"corpus\":\"" << corpus.name << "\""
+			<< ",\"size\":" << size
+			<< ",\"bytes\":" << corpus.src.length()
+			<< ",\"tokens\":" << tokenCount
+			<< ",\"nodes\":" << nodeCount
+			<< ",\"evaluations\":" << evaluationCount
+			<< ",\"lex\":";
+		print_phase(lexPhase, "tokens_per_second", tokenCount);
+		std::cout << ",\"parse\":";
+		print_phase(parsePhase, "nodes_per_second", nodeCount);
+		std::cout << ",\"interpret\":";
+		print_phase(interpretPhase, "evaluations_per_second", evaluationCount);
+		std::cout << "}" << std::endl;
+	}
+
+	return 0;
+}
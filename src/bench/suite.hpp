@@ -0,0 +1,103 @@
+#ifndef __LG_BENCH_SUITE__
+#define __LG_BENCH_SUITE__
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AquIce/langgen/lexer.hpp>
+#include <AquIce/langgen/parser.hpp>
+#include <AquIce/langgen/interpreter.hpp>
+
+namespace bench {
+	/**
+	 * A synthetic source to run through every phase
+	 */
+	typedef struct Corpus {
+		std::string name;
+		std::string src;
+	} Corpus;
+
+	/**
+	 * The setup functions of a grammar, and the ways to count the nodes of its statements
+	 * and the nodes evaluated when interpreting them
+	 */
+	typedef struct Grammar {
+		std::string name;
+		std::function<void(langgen::lexer::Lexer&)> setupLexer;
+		std::function<void(langgen::parser::Parser&)> setupParser;
+		std::function<void(langgen::interpreter::Interpreter&)> setupInterpreter;
+		std::function<size_t(const std::shared_ptr<langgen::ast::Statement>&)> countNodes;
+		std::function<size_t(const std::shared_ptr<langgen::ast::Statement>&)> countEvaluations;
+	} Grammar;
+
+	/**
+	 * Get the number of allocations made since the start of the benchmark
+	 * @note Counted by the replacement of the global `operator new` in `allocations.cpp`
+	 */
+	size_t allocations();
+
+	/**
+	 * Get the number of bytes allocated since the start of the benchmark
+	 */
+	size_t allocated_bytes();
+
+	/**
+	 * Get the corpus size and the repetitions from the command line
+	 * @note Usage: <bench> [size] [repetitions], the size being the number of operands of each corpus
+	 */
+	void read_arguments(int argc, char** argv, size_t& size, size_t& repetitions);
+
+	/**
+	 * Get the corpora shared by the grammars of numbers, booleans, `!` and binary operators
+	 * @param size The number of operands of each corpus
+	 * @return Long expressions, deeply nested chains and statements surrounded by comments
+	 */
+	std::vector<Corpus> expression_corpora(size_t size);
+
+	/**
+	 * Lex, parse and interpret each corpus, printing one JSON object per corpus on the standard output
+	 * @param size The size given to the corpora, reported with the results
+	 * @param repetitions The number of times each phase is run, the fastest run being reported
+	 * @return The exit code of the benchmark
+	 */
+	int run_suite(const Grammar& grammar, const std::vector<Corpus>& corpora, size_t size, size_t repetitions);
+
+	/**
+	 * Get an identifier made of letters only, as Tlang identifiers are
+	 * @param prefix The letters the identifier starts with
+	 * @param index The index of the identifier, written after the prefix in base 26
+	 */
+	std::string identifier(std::string prefix, size_t index);
+
+	/**
+	 * Generate a source made of `count` lines
+	 * @param line Get the line at an index, its line break included
+	 */
+	std::string generate_source(size_t count, const std::function<std::string(size_t)>& line);
+
+	/**
+	 * Generate a source of at least `bytes` bytes, made of as many lines as needed
+	 * @param line Get the line at an index, its line break included
+	 */
+	std::string generate_source_bytes(size_t bytes, const std::function<std::string(size_t)>& line);
+
+	/**
+	 * Get the time taken by a call, in seconds
+	 */
+	template <typename Fn>
+	double seconds(Fn fn) {
+		auto start = std::chrono::steady_clock::now();
+		fn();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	/**
+	 * Get the time taken to parse a copy of some tokens into a new program, in seconds
+	 */
+	double parse_seconds(langgen::parser::Parser& parser, const std::vector<langgen::lexer::Token>& tokens);
+}
+
+#endif // __LG_BENCH_SUITE__
@@ -0,0 +1,38 @@
+#include "suite.hpp"
+
+#include "../demo/grammar.hpp"
+
+// Benchmark suite on the demo grammar of `demo/grammar.cpp`
+// Usage: lg_bench_suite_demo [size] [repetitions]
+// The demo grammar has no declarations, only the expression corpora are run.
+
+size_t count_nodes(const std::shared_ptr<langgen::ast::Statement>& statement) {
+	if(std::shared_ptr<BinaryExpression> binaryExpression = std::dynamic_pointer_cast<BinaryExpression>(statement)) {
+		return 1 + count_nodes(binaryExpression->get_left()) + count_nodes(binaryExpression->get_right());
+	}
+	if(std::shared_ptr<UnaryExpression> unaryExpression = std::dynamic_pointer_cast<UnaryExpression>(statement)) {
+		return 1 + count_nodes(unaryExpression->get_term());
+	}
+	return 1;
+}
+
+int main(int argc, char** argv) {
+	size_t size;
+	size_t repetitions;
+	bench::read_arguments(argc, argv, size, repetitions);
+
+	return bench::run_suite(
+		bench::Grammar{
+			"demo",
+			&setup_lexer,
+			&setup_parser,
+			&setup_interpreter,
+			&count_nodes,
+			// Every node is evaluated once
+			&count_nodes
+		},
+		bench::expression_corpora(size),
+		size,
+		repetitions
+	);
+}
@@ -0,0 +1,63 @@
+#include "suite.hpp"
+
+#include "../../example/Tlang/core.hpp"
+
+// Benchmark suite on the Tlang example grammar
+// Usage: lg_bench_suite_tlang [size] [repetitions]
+// Runs the expression corpora, and a corpus of declarations of numbers and booleans,
+// each number being computed from the previous one.
+
+bench::Corpus many_declarations(size_t size) {
+	bench::Corpus corpus = bench::Corpus{ "many_declarations", "" };
+
+	// Four operands per pair of declarations
+	corpus.src = bench::generate_source(std::max<size_t>(size / 4, 1), [](size_t i) {
+		std::string previous = i == 0 ? "1" : bench::identifier("x", i - 1);
+		return
+			"let " + bench::identifier("x", i) + ": number = " + previous + " + " + std::to_string(i % 9 + 1) + "\n" +
+			"const " + bench::identifier("y", i) + ": boolean = !true || false\n";
+	});
+
+	return corpus;
+}
+
+size_t count_nodes(const std::shared_ptr<langgen::ast::Statement>& statement, bool evaluatedOnly) {
+	if(std::shared_ptr<tlang::ast::AssignationExpression> assignationExpression = std::dynamic_pointer_cast<tlang::ast::AssignationExpression>(statement)) {
+		// The assigned identifier is not evaluated
+		return (evaluatedOnly ? 1 : 2) + count_nodes(assignationExpression->get_value(), evaluatedOnly);
+	}
+	if(std::shared_ptr<tlang::ast::BinaryExpression> binaryExpression = std::dynamic_pointer_cast<tlang::ast::BinaryExpression>(statement)) {
+		return 1 + count_nodes(binaryExpression->get_left(), evaluatedOnly) + count_nodes(binaryExpression->get_right(), evaluatedOnly);
+	}
+	if(std::shared_ptr<tlang::ast::UnaryExpression> unaryExpression = std::dynamic_pointer_cast<tlang::ast::UnaryExpression>(statement)) {
+		return 1 + count_nodes(unaryExpression->get_term(), evaluatedOnly);
+	}
+	return 1;
+}
+
+int main(int argc, char** argv) {
+	size_t size;
+	size_t repetitions;
+	bench::read_arguments(argc, argv, size, repetitions);
+
+	std::vector<bench::Corpus> corpora = bench::expression_corpora(size);
+	corpora.push_back(many_declarations(size));
+
+	return bench::run_suite(
+		bench::Grammar{
+			"tlang",
+			&setup_lexer,
+			&setup_parser,
+			&setup_interpreter,
+			[](const std::shared_ptr<langgen::ast::Statement>& statement) -> size_t {
+				return count_nodes(statement, false);
+			},
+			[](const std::shared_ptr<langgen::ast::Statement>& statement) -> size_t {
+				return count_nodes(statement, true);
+			}
+		},
+		corpora,
+		size,
+		repetitions
+	);
+}
@@ -0,0 +1,94 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+// Token types scaling benchmark
+// Usage: lg_bench_token_types [source_bytes]
+// Lexes the same kind of source with grammars of 10 to 240 keywords, once with the literal
+// token types compiled into the prefix trie and once with the same token types tried one by one.
+
+std::string keyword(size_t index) {
+	std::string word = "kw";
+	for(size_t i = index; ; i /= 26) {
+		word += static_cast<char>('a' + i % 26);
+		if(i < 26) {
+			break;
+		}
+	}
+	return word;
+}
+
+std::vector<langgen::lexer::TokenType> make_token_types(size_t keywords, bool compiled) {
+	std::vector<langgen::lexer::TokenType> tokenTypes;
+
+	for(size_t i = 0; i < keywords; i++) {
+		langgen::lexer::TokenType tokenType = langgen::lexer::make_token_type("KEYWORD", keyword(i));
+		if(!compiled) {
+			// Without a literal, the token type is tried in declaration order like a custom one
+			tokenType.literal = "";
+		}
+		tokenTypes.push_back(tokenType);
+	}
+
+	tokenTypes.push_back(langgen::lexer::make_token_type(
+		"IDENTIFIER",
+		[](std::string_view src) -> size_t {
+			size_t i = 0;
+			while(i < src.length() && (isalpha(src.at(i)) || src.at(i) == '_')) {
+				i++;
+			}
+			return i;
+		}
+	));
+
+	return tokenTypes;
+}
+
+std::string generate_source(size_t keywords, size_t size) {
+	return bench::generate_source_bytes(size, [&](size_t i) {
+		return keyword((i * 7919) % keywords) + (i % 8 == 7 ? "\n" : " ") + (i % 5 == 4 ? "name " : "");
+	});
+}
+
+int main(int argc, char** argv) {
+	size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000 * 1000;
+
+	std::cout << "token_types\ttokens\tlinear_tokens/s\ttrie_tokens/s" << std::endl;
+
+	for(size_t keywords : std::vector<size_t>({ 10, 20, 40, 80, 120, 240 })) {
+		std::string src = generate_source(keywords, size);
+
+		langgen::lexer::Lexer linearLexer;
+		langgen::lexer::setup_lexer(linearLexer, make_token_types(keywords, false));
+		langgen::lexer::Lexer trieLexer;
+		langgen::lexer::setup_lexer(trieLexer, make_token_types(keywords, true));
+
+		std::vector<langgen::lexer::Token> linearTokens;
+		std::vector<langgen::lexer::Token> trieTokens;
+
+		double linearSeconds = bench::seconds([&]() { langgen::lexer::lex(linearLexer, linearTokens, src); });
+		double trieSeconds = bench::seconds([&]() { langgen::lexer::lex(trieLexer, trieTokens, src); });
+
+		for(size_t i = 0; i < linearTokens.size(); i++) {
+			if(
+				trieTokens.size() != linearTokens.size() ||
+				trieTokens.at(i).type != linearTokens.at(i).type ||
+				trieTokens.at(i).value != linearTokens.at(i).value
+			) {
+				std::cerr << "Token streams differ at token " << i << std::endl;
+				return 1;
+			}
+		}
+
+		std::cout
+			<< keywords + 1 << "\t"
+			<< trieTokens.size() << "\t"
+			<< linearTokens.size() / linearSeconds << "\t"
+			<< trieTokens.size() / trieSeconds << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,95 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "suite.hpp"
+
+#include "../../example/Tlang/core.hpp"
+
+// Execution engine benchmark on the Tlang example grammar
+// Usage: lg_bench_vm [declarations] [runs]
+// Runs the same resolved program many times, with the tree-walking interpreter,
+// then compiled once to bytecode and run by the VM, and checks both give the same results.
+
+std::string generate_source(size_t declarations) {
+	return bench::generate_source(declarations, [](size_t i) {
+		if(i == 0) {
+			return "let " + bench::identifier("x", 0) + ": number = 1\n";
+		}
+		std::string previous = bench::identifier("x", i - 1);
+		return
+			"let " + bench::identifier("x", i) + ": number = " + previous + " * 2 - " + previous + " / 4 + 1\n" +
+			"let " + bench::identifier("b", i) + ": boolean = !" + previous + " && false || true\n";
+	});
+}
+
+std::string render(const langgen::interpreter::ResultSink& sink) {
+	std::string rendered;
+	for(const langgen::interpreter::StatementResult& result : sink.results) {
+		rendered += result.value.repr() + "\n";
+	}
+	return rendered;
+}
+
+int main(int argc, char** argv) {
+	size_t declarations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100;
+	size_t runs = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+
+	langgen::lexer::Lexer lexer;
+	setup_lexer(lexer);
+
+	std::vector<langgen::lexer::Token> tokens;
+	langgen::lexer::lex(lexer, tokens, generate_source(declarations));
+
+	langgen::parser::Parser parser;
+	setup_parser(parser);
+
+	std::shared_ptr<langgen::ast::Scope> program = std::make_shared<langgen::ast::Scope>();
+	langgen::parser::parse(parser, program, tokens);
+
+	langgen::resolver::Resolver resolver;
+	setup_resolver(resolver);
+	langgen::resolver::resolve(resolver, program);
+
+	langgen::interpreter::Interpreter interpreter;
+	setup_interpreter(interpreter);
+
+	langgen::vm::VM vm;
+	setup_vm(vm);
+
+	langgen::interpreter::ResultSink treeResults = langgen::interpreter::ResultSink{langgen::interpreter::ResultPolicy::ORDERED};
+	langgen::interpreter::interpret(interpreter, treeResults, program);
+
+	langgen::vm::Program compiled = langgen::vm::compile(vm, interpreter, program);
+
+	langgen::interpreter::ResultSink vmResults = langgen::interpreter::ResultSink{langgen::interpreter::ResultPolicy::ORDERED};
+	langgen::vm::run(vm, interpreter, compiled, vmResults);
+
+	if(render(treeResults) != render(vmResults)) {
+		std::cerr << "The VM and the interpreter give different results" << std::endl;
+		return 1;
+	}
+
+	langgen::interpreter::ResultSink sink = langgen::interpreter::ResultSink{langgen::interpreter::ResultPolicy::LAST};
+
+	double treeSeconds = bench::seconds([&]() {
+		for(size_t i = 0; i < runs; i++) {
+			sink.results.clear();
+			langgen::interpreter::interpret(interpreter, sink, program);
+		}
+	});
+
+	double vmSeconds = bench::seconds([&]() {
+		for(size_t i = 0; i < runs; i++) {
+			sink.results.clear();
+			langgen::vm::run(vm, interpreter, compiled, sink);
+		}
+	});
+
+	std::cout << "engine\truns\tinstructions\tseconds\truns/s" << std::endl;
+	std::cout << "tree_walker\t" << runs << "\t-\t" << treeSeconds << "\t" << runs / treeSeconds << std::endl;
+	std::cout << "vm\t" << runs << "\t" << compiled.code.size() << "\t" << vmSeconds << "\t" << runs / vmSeconds << std::endl;
+
+	return 0;
+}
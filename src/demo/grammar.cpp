@@ -0,0 +1,322 @@
+#include "grammar.hpp"
+
+#pragma region Lexer Implementation
+
+void setup_lexer(langgen::lexer::Lexer& lexer) {
+	std::vector<langgen::lexer::TokenType> tokenTypes = std::vector<langgen::lexer::TokenType>({
+		langgen::lexer::make_token_type("("),
+		langgen::lexer::make_token_type(")"),
+		langgen::lexer::make_token_type("OPERATOR", "+"),
+		langgen::lexer::make_token_type("OPERATOR", "-"),
+		langgen::lexer::make_token_type("OPERATOR", "*"),
+		langgen::lexer::make_token_type("OPERATOR", "/"),
+		langgen::lexer::make_token_type("OPERATOR", "&&"),
+		langgen::lexer::make_token_type("OPERATOR", "||"),
+		langgen::lexer::make_token_type("UNARY_OPERATOR", "!"),
+		langgen::lexer::make_token_type("BOOL", "true"),
+		langgen::lexer::make_token_type("BOOL", "false"),
+		langgen::lexer::make_token_type(
+			"NUMBER",
+			[lexer](std::string_view src) -> size_t {
+				size_t i = 0;
+				bool isInteger = true;
+				while(i < src.length() && (isdigit(src.at(i)) || src.at(i) == lexer.decimalSeparator)) {
+					if(src.at(i) == lexer.decimalSeparator) {
+						if(!isInteger) {
+							throw std::runtime_error("Invalid number format");
+						}
+						isInteger = false;
+					}
+					i++;
+				}
+				return i;
+			}
+		)
+	});
+
+	langgen::lexer::setup_lexer(
+		lexer,
+		tokenTypes
+	);
+}
+
+#pragma endregion
+
+#pragma region Parser Implementation
+
+const langgen::lexer::TokenKind BOOL_KIND = langgen::lexer::token_kind("BOOL");
+const langgen::lexer::TokenKind UNARY_OPERATOR_KIND = langgen::lexer::token_kind("UNARY_OPERATOR");
+const langgen::lexer::TokenKind OPERATOR_KIND = langgen::lexer::token_kind("OPERATOR");
+
+std::shared_ptr<langgen::ast::Expression> parse_boolean_expression(langgen::parser::TokenStream& tokens) {
+	if(peek(tokens).kind == BOOL_KIND) {
+		return langgen::parser::make_statement<BooleanExpression>(tokens, eat(tokens).value == "true");
+	}
+	return langgen::parser::parse_number_expression(tokens);
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_unary_expression(langgen::parser::TokenStream& tokens) {
+
+	std::string operator_symbol = "";
+
+	if(peek(tokens).kind == UNARY_OPERATOR_KIND) {
+		operator_symbol = eat(tokens).value;
+	}
+	
+	std::shared_ptr<langgen::ast::Expression> term = parse_boolean_expression(tokens);
+
+	return operator_symbol.size() == 0 ? term : langgen::parser::make_statement<UnaryExpression>(tokens, term, operator_symbol);
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_multiplicative_expression(langgen::parser::TokenStream& tokens) {
+	std::shared_ptr<langgen::ast::Expression> left = parse_unary_expression(tokens);
+
+	if(left == nullptr) {
+		return nullptr;
+	}
+
+	if(
+		peek(tokens).kind == OPERATOR_KIND &&
+		(peek(tokens).value == "*" || peek(tokens).value == "/")
+	) {
+		std::string operator_symbol = eat(tokens).value;
+		std::shared_ptr<langgen::ast::Expression> right = parse_multiplicative_expression(tokens);
+		
+		return langgen::parser::make_statement<BinaryExpression>(
+			tokens,
+			left,
+			operator_symbol,
+			right
+		);
+	}
+	
+	return left;
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_additive_expression(langgen::parser::TokenStream& tokens) {
+	std::shared_ptr<langgen::ast::Expression> left = parse_multiplicative_expression(tokens);
+
+	if(left == nullptr) {
+		return nullptr;
+	}
+
+	if(
+		peek(tokens).kind == OPERATOR_KIND &&
+		(peek(tokens).value == "+" || peek(tokens).value == "-")
+	) {
+		std::string operator_symbol = eat(tokens).value;
+		std::shared_ptr<langgen::ast::Expression> right = parse_additive_expression(tokens);
+		
+		return langgen::parser::make_statement<BinaryExpression>(
+			tokens,
+			left,
+			operator_symbol,
+			right
+		);
+	}
+	
+	return left;
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_logical_expression(langgen::parser::TokenStream& tokens) {
+	std::shared_ptr<langgen::ast::Expression> left = parse_additive_expression(tokens);
+
+	if(left == nullptr) {
+		return nullptr;
+	}
+
+	if(
+		peek(tokens).kind == OPERATOR_KIND &&
+		(peek(tokens).value == "&&" || peek(tokens).value == "||")
+	) {
+		std::string operator_symbol = eat(tokens).value;
+		std::shared_ptr<langgen::ast::Expression> right = parse_logical_expression(tokens);
+		
+		return langgen::parser::make_statement<BinaryExpression>(
+			tokens,
+			left,
+			operator_symbol,
+			right
+		);
+	}
+	
+	return left;
+}
+
+std::shared_ptr<langgen::ast::Expression> parse_binary_expression(langgen::parser::TokenStream& tokens) {
+	return parse_logical_expression(tokens);
+}
+
+void setup_parser(langgen::parser::Parser& parser) {
+
+	langgen::parser::setup_parser(
+		parser,
+		{
+			{
+				"BooleanExpression",
+				langgen::parser::make_node(&parse_boolean_expression, false)
+			},
+			{
+				"UnaryExpression",
+				langgen::parser::make_node(&parse_unary_expression, false)
+			},
+			{
+				"BinaryExpression",
+				langgen::parser::make_node(&parse_binary_expression)
+			},
+		}
+	);
+
+	langgen::parser::demoteTopNode(parser, "NumberExpression");
+}
+
+#pragma endregion
+
+#pragma region Interpreter Implementation
+
+bool validate_mutability(const langgen::env::EnvValue& value) {
+	try {
+		return value.properties.at("isMutable") == "true";
+	} catch(const std::exception& e) {
+		throw std::runtime_error("Trying to access undeclared property \"isMutable\"");
+	}
+}
+
+std::shared_ptr<langgen::values::RuntimeValue> evaluate_boolean_expression (
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Statement> statement,
+	std::shared_ptr<langgen::env::Environment> env
+) {
+	std::shared_ptr<BooleanExpression> booleanExpression = std::dynamic_pointer_cast<BooleanExpression>(statement);
+
+	return std::make_shared<BooleanValue>(booleanExpression->value);
+};
+
+std::shared_ptr<langgen::values::RuntimeValue> evaluate_unary_expression (
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Statement> statement,
+	std::shared_ptr<langgen::env::Environment> env
+) {
+	std::shared_ptr<UnaryExpression> unaryExpression = std::dynamic_pointer_cast<UnaryExpression>(statement);
+
+	std::shared_ptr<langgen::values::RuntimeValue> term = langgen::interpreter::evaluate_statement(interpreter, unaryExpression->get_term(), env);
+	std::string operator_symbol = unaryExpression->get_operator_symbol();
+
+	if(operator_symbol == "!") {
+		return std::make_shared<BooleanValue>(!term->IsTrue());
+	}
+
+	throw std::runtime_error("Unknown unary operator " + operator_symbol);
+}
+
+std::shared_ptr<langgen::values::RuntimeValue> evaluate_binary_expression (
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Statement> statement,
+	std::shared_ptr<langgen::env::Environment> env
+) {
+	std::shared_ptr<BinaryExpression> binaryExpression = std::dynamic_pointer_cast<BinaryExpression>(statement);
+
+	std::shared_ptr<langgen::values::RuntimeValue> left = langgen::interpreter::evaluate_statement(interpreter, binaryExpression->get_left(), env);
+	std::shared_ptr<langgen::values::RuntimeValue> right = langgen::interpreter::evaluate_statement(interpreter, binaryExpression->get_right(), env);
+
+	std::string operator_symbol = binaryExpression->get_operator_symbol();
+
+	if(operator_symbol == "+") {
+		if(
+			left->type() != "NumberValue" ||
+			right->type() != "NumberValue"
+		) {
+			throw std::runtime_error("Trying to add invalid operands");
+		}
+
+		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
+		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
+		
+		return std::make_shared<langgen::values::NumberValue>(left_nb + right_nb);
+	}
+	if(operator_symbol == "-") {
+		if(
+			left->type() != "NumberValue" ||
+			right->type() != "NumberValue"
+		) {
+			throw std::runtime_error("Trying to subtract invalid operands");
+		}
+		
+		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
+		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
+		
+		return std::make_shared<langgen::values::NumberValue>(left_nb - right_nb);
+	}
+	if(operator_symbol == "*") {
+		if(
+			left->type() != "NumberValue" ||
+			right->type() != "NumberValue"
+		) {
+			throw std::runtime_error("Trying to multiply invalid operands");
+		}
+		
+		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
+		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
+		
+		return std::make_shared<langgen::values::NumberValue>(left_nb * right_nb);
+	}
+	if(operator_symbol == "/") {
+		if(
+			left->type() != "NumberValue" ||
+			right->type() != "NumberValue"
+		) {
+			throw std::runtime_error("Trying to divide invalid operands");
+		}
+		
+		double left_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(left)->get();
+		double right_nb = std::dynamic_pointer_cast<langgen::values::NumberValue>(right)->get();
+
+		if(right_nb == 0) {
+			throw std::runtime_error("Trying to divide by zero");
+		}
+		
+		return std::make_shared<langgen::values::NumberValue>(left_nb / right_nb);
+	}
+	if(operator_symbol == "&&") {
+		return std::make_shared<BooleanValue>(left->IsTrue() && right->IsTrue());
+	}
+	if(operator_symbol == "||") {
+		return std::make_shared<BooleanValue>(left->IsTrue() || right->IsTrue());
+	}
+
+	throw std::runtime_error("Unknown operator " + operator_symbol);
+}
+
+void setup_interpreter(langgen::interpreter::Interpreter& interpreter) {
+
+	std::unordered_map<std::string, langgen::interpreter::ParseStatementFunction> nodeEvaluationFunctions = std::unordered_map<std::string, langgen::interpreter::ParseStatementFunction>({
+		{ "BooleanExpression", &evaluate_boolean_expression },
+		{ "UnaryExpression", &evaluate_unary_expression },
+		{ "BinaryExpression", &evaluate_binary_expression },
+	});
+
+	std::vector<std::string> envValuesProperties = std::vector<std::string>({
+		"isMutable"
+	});
+
+	langgen::env::EnvValidationRule mutabilityValidation = {
+		&validate_mutability,
+		std::vector<langgen::env::ValidationRuleSensitivity>({
+			langgen::env::ValidationRuleSensitivity::SET
+		})
+	};
+
+	std::vector<langgen::env::EnvValidationRule> validationRules = std::vector<langgen::env::EnvValidationRule>({
+		mutabilityValidation
+	});
+
+	langgen::interpreter::setup_interpreter(
+		interpreter,
+		nodeEvaluationFunctions,
+		envValuesProperties,
+		validationRules
+	);
+
+}
+
+#pragma endregion
@@ -0,0 +1,164 @@
+#ifndef __LG_DEMO_GRAMMAR__
+#define __LG_DEMO_GRAMMAR__
+
+#include <string>
+#include <vector>
+
+#include <AquIce/langgen/lexer.hpp>
+#include <AquIce/langgen/parser.hpp>
+#include <AquIce/langgen/interpreter.hpp>
+
+#pragma region Prototypes
+
+void setup_lexer(langgen::lexer::Lexer& lexer);
+
+std::shared_ptr<langgen::ast::Expression> parse_multiplicative_expression(langgen::parser::TokenStream& tokens);
+std::shared_ptr<langgen::ast::Expression> parse_additive_expression(langgen::parser::TokenStream& tokens);
+std::shared_ptr<langgen::ast::Expression> parse_binary_expression(langgen::parser::TokenStream& tokens);
+
+void setup_parser(langgen::parser::Parser& parser);
+
+bool validate_mutability(const langgen::env::EnvValue& value);
+
+std::shared_ptr<langgen::values::RuntimeValue> evaluate_boolean_expression (
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Statement> statement,
+	std::shared_ptr<langgen::env::Environment> env
+);
+std::shared_ptr<langgen::values::RuntimeValue> evaluate_unary_expression (
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Statement> statement,
+	std::shared_ptr<langgen::env::Environment> env
+);
+std::shared_ptr<langgen::values::RuntimeValue> evaluate_binary_expression (
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Statement> statement,
+	std::shared_ptr<langgen::env::Environment> env
+);
+
+void setup_interpreter(langgen::interpreter::Interpreter& interpreter);
+
+#pragma endregion
+
+#pragma region Parser Classes
+
+class BooleanExpression : public langgen::ast::Expression {
+public:
+	bool value;
+
+	BooleanExpression(bool value) {
+		this->value = value;
+	}
+	
+	virtual std::string type() override {
+		return "BooleanExpression";
+	}
+	virtual std::string repr(int indent = 0) {
+		return std::string(indent, '\t') + std::string(this->value ? "true" : "false");
+	}
+};
+
+class UnaryExpression : public langgen::ast::Expression {
+public:
+	UnaryExpression(std::shared_ptr<langgen::ast::Expression> term, std::string operator_symbol) {
+		this->term = term;
+		this->operator_symbol = operator_symbol;
+	}
+
+	std::shared_ptr<langgen::ast::Expression> get_term() {
+		return this->term;
+	}
+	std::string get_operator_symbol() {
+		return this->operator_symbol;
+	}
+
+	virtual std::string type() override {
+		return "UnaryExpression";
+	}
+
+	virtual std::string repr(int indent = 0) {
+		return
+			std::string(indent, '\t') + "(\n" +
+			std::string(indent + 1, '\t') + this->operator_symbol + "\n" +
+			this->term->repr(indent + 1) + "\n" +
+			std::string(indent, '\t') + ")";
+	}
+
+private:
+	std::shared_ptr<langgen::ast::Expression> term;
+	std::string operator_symbol;
+};
+
+class BinaryExpression : public langgen::ast::Expression {
+public:
+	BinaryExpression(std::shared_ptr<langgen::ast::Expression> left, std::string operator_symbol, std::shared_ptr<langgen::ast::Expression> right) {
+		this->left = left;
+		this->operator_symbol = operator_symbol;
+		this->right = right;
+	}
+
+	std::shared_ptr<langgen::ast::Expression> get_left() {
+		return this->left;
+	}
+	std::string get_operator_symbol() {
+		return this->operator_symbol;
+	}
+	std::shared_ptr<langgen::ast::Expression> get_right() {
+		return this->right;
+	}
+	
+	virtual std::string type() override {
+		return "BinaryExpression";
+	}
+
+	virtual std::string repr(int indent = 0) {
+		return
+			std::string(indent, '\t') + "(\n" +
+			this->left->repr(indent + 1) + "\n" +
+			std::string(indent + 1, '\t') + this->operator_symbol + "\n" +
+			this->right->repr(indent + 1) + "\n" +
+			std::string(indent, '\t') + ")";
+	}
+
+private:
+	std::shared_ptr<langgen::ast::Expression> left;
+	std::string operator_symbol;
+	std::shared_ptr<langgen::ast::Expression> right;
+};
+
+#pragma endregion
+
+#pragma region Interpreter Classes
+
+class BooleanValue: public langgen::values::RuntimeValue {
+public:
+	/**
+	 * Create a new Null Value
+	 */
+	BooleanValue(bool value = false) {
+		this->value = value;
+	}
+	
+	bool get() {
+		return this->value;
+	}
+
+	virtual std::string type() override {
+		return "BooleanValue";
+	}
+	
+	virtual std::string repr() override {
+		return this->value ? "true" : "false";
+	}
+	
+	virtual bool IsTrue() override {
+		return this->get();
+	}
+
+private:
+	bool value;
+};
+
+#pragma endregion
+
+#endif // __LG_DEMO_GRAMMAR__
@@ -4,15 +4,177 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <utility>
 
 namespace langgen {
 	namespace ast {
 
+		class Arena;
 		class Statement;
 		class Scope;
 		class Expression;
 		class NumberExpression;
 
+		/**
+		 * A dense integer id identifying a NodeType
+		 */
+		typedef size_t NodeKind;
+
+		/**
+		 * The kind of a Statement whose NodeType has not been interned yet
+		 */
+		const NodeKind NO_NODE_KIND = static_cast<NodeKind>(-1);
+
+		/**
+		 * Get the kind of a NodeType, interning it on first use
+		 * @param type The NodeType
+		 * @return The kind
+		 */
+		NodeKind node_kind(const std::string& type);
+
+		/**
+		 * Get the NodeType of an interned node kind
+		 * @param kind The kind
+		 * @return The NodeType
+		 */
+		const std::string& node_kind_name(NodeKind kind);
+
+		/**
+		 * Get the kind of the NodeType of a node class, interned on the first call for the class
+		 * @param node A node of the class
+		 * @note The NodeType of a node class must not depend on its instances
+		 */
+		template <typename T>
+		NodeKind class_node_kind(T& node) {
+			static const NodeKind kind = node_kind(node.type());
+			return kind;
+		}
+
+		/**
+		 * The blocks of memory of an arena, released with the last of the arena and the nodes allocated in it
+		 */
+		class ArenaMemory {
+		public:
+			ArenaMemory(size_t blockSize);
+
+			ArenaMemory(const ArenaMemory&) = delete;
+			ArenaMemory& operator=(const ArenaMemory&) = delete;
+
+			/**
+			 * Reserve memory for a node, which holds a reference to the memory until it is released
+			 * @note Not thread-safe, nodes are allocated by a single parser
+			 */
+			void* allocate(size_t size, size_t alignment);
+
+			/**
+			 * Drop a reference to the memory, deleting it with the last one
+			 * @note Thread-safe, nodes may be destroyed on any thread
+			 */
+			void release();
+
+			/**
+			 * Get the number of bytes reserved by the memory
+			 */
+			size_t capacity();
+
+		private:
+			size_t blockSize;
+			size_t offset;
+			std::vector<std::unique_ptr<char[]>> blocks;
+			std::vector<size_t> blockSizes;
+			/**
+			 * The number of nodes allocated in the memory and not destroyed yet, plus one while the arena lives
+			 */
+			std::atomic<size_t> references{1};
+		};
+
+		/**
+		 * An allocator bumping the memory of an arena, for `std::allocate_shared`
+		 * @note Copies do no reference counting, each allocation holds a reference to the memory until it is deallocated
+		 */
+		template <typename T>
+		class ArenaAllocator {
+		public:
+			typedef T value_type;
+
+			ArenaAllocator(ArenaMemory* memory) {
+				this->memory = memory;
+			}
+
+			template <typename U>
+			ArenaAllocator(const ArenaAllocator<U>& other) {
+				this->memory = other.memory;
+			}
+
+			T* allocate(size_t count) {
+				return static_cast<T*>(this->memory->allocate(count * sizeof(T), alignof(T)));
+			}
+
+			void deallocate(T*, size_t) {
+				this->memory->release();
+			}
+
+			template <typename U>
+			bool operator==(const ArenaAllocator<U>& other) const {
+				return this->memory == other.memory;
+			}
+
+			template <typename U>
+			bool operator!=(const ArenaAllocator<U>& other) const {
+				return this->memory != other.memory;
+			}
+
+		private:
+			template <typename U>
+			friend class ArenaAllocator;
+
+			ArenaMemory* memory;
+		};
+
+		/**
+		 * A bump allocator for AST nodes, releasing its memory at once
+		 * @note Nodes are destroyed with their last owner as with `std::make_shared`, and keep the memory alive, they can outlive the arena
+		 */
+		class Arena {
+		public:
+			Arena(size_t blockSize = 64 * 1024);
+			~Arena();
+
+			Arena(const Arena&) = delete;
+			Arena& operator=(const Arena&) = delete;
+
+			/**
+			 * Construct a node in the arena
+			 * @return An owning pointer to the node, as `std::make_shared` returns
+			 */
+			template <typename T, typename... Args>
+			std::shared_ptr<T> make(Args&&... args) {
+				std::shared_ptr<T> node = std::allocate_shared<T>(
+					ArenaAllocator<T>(this->memory),
+					std::forward<Args>(args)...
+				);
+				node->set_kind(class_node_kind(*node));
+				return node;
+			}
+
+			/**
+			 * Get the number of bytes reserved by the arena
+			 */
+			size_t capacity();
+
+		private:
+			ArenaMemory* memory;
+		};
+
+		/**
+		 * A range of tokens, from `start` included to `end` excluded
+		 */
+		typedef struct TokenSpan {
+			size_t start;
+			size_t end;
+		} TokenSpan;
+
 		/**
 		 * Statement
 		 * @note This class is only used for inheritance purpose, never as a value
@@ -29,6 +191,22 @@ namespace langgen {
 			 * Get the string representation of the Statement
 			 */
 			virtual std::string repr(int indent = 0);
+
+			/**
+			 * Get the interned kind of the NodeType of the Statement
+			 * @note Read from the Statement if it was created by `make`, `Arena::make` or `make_statement`,
+			 * else looked up by the class of the Statement, interning `type()` on the first call for the class on each thread
+			 */
+			NodeKind kind();
+
+			/**
+			 * Set the interned kind of the NodeType of the Statement
+			 * @note Called at creation by `make`, `Arena::make` and `make_statement`, before the Statement is shared
+			 */
+			void set_kind(NodeKind kind);
+
+		private:
+			NodeKind nodeKind = NO_NODE_KIND;
 		};
 
 		/**
@@ -38,6 +216,15 @@ namespace langgen {
 		class Scope : public Statement {
 		public:
 			std::vector<std::shared_ptr<Statement>> body;
+			/**
+			 * The arena the nodes of the scope were allocated in, if it was parsed into one
+			 */
+			std::shared_ptr<Arena> arena;
+			/**
+			 * The tokens of each statement of the body, set by `parse`
+			 * @note Used by `reparse` to only parse the statements touched by an edit again
+			 */
+			std::vector<TokenSpan> spans;
 			
 			Scope(std::vector<std::shared_ptr<Statement>> body = std::vector<std::shared_ptr<Statement>>());
 			
@@ -63,6 +250,18 @@ namespace langgen {
 			virtual std::string type() override;
 			virtual std::string repr(int indent = 0);
 		};
+
+		/**
+		 * Create a node with its kind set, as `std::make_shared` does
+		 * @param args The arguments of the node constructor
+		 * @return The node
+		 */
+		template <typename T, typename... Args>
+		std::shared_ptr<T> make(Args&&... args) {
+			std::shared_ptr<T> node = std::make_shared<T>(std::forward<Args>(args)...);
+			node->set_kind(class_node_kind(*node));
+			return node;
+		}
 	}
 }
 
@@ -2,13 +2,16 @@
 #define __LANGGEN_ENV__
 
 #include <AquIce/langgen/values.hpp>
+#include <AquIce/langgen/stats.hpp>
 
 #include <string>
+#include <vector>
 #include <memory>
 #include <algorithm>
 #include <unordered_map>
 #include <stdexcept>
 #include <functional>
+#include <optional>
 
 namespace langgen {
 	namespace env {
@@ -19,6 +22,50 @@ namespace langgen {
 			GET
 		};
 
+		class EnvSchema;
+
+		/**
+		 * The properties of an environment value, stored by property id
+		 */
+		class Properties {
+		public:
+			/**
+			 * Create empty properties for a schema
+			 * @note The properties hold the schema, they stay valid after the interpreter compiles a new one
+			 */
+			Properties(std::shared_ptr<const EnvSchema> schema = nullptr);
+
+			/**
+			 * Get the value of a property
+			 * @throws std::out_of_range if the property is not declared in the schema or not set
+			 */
+			const std::string& at(const std::string& name) const;
+
+			/**
+			 * Get the value of a property from its id
+			 * @throws std::out_of_range if the property is not set
+			 */
+			const std::string& at(size_t id) const;
+
+			/**
+			 * Set the value of a property
+			 * @throws std::runtime_error if the property is not declared in the schema
+			 */
+			void set(const std::string& name, std::string value);
+
+			/**
+			 * Set the value of a property from its id
+			 */
+			void set(size_t id, std::string value);
+
+		private:
+			std::shared_ptr<const EnvSchema> schema;
+			/**
+			 * The property values, indexed by property id
+			 */
+			std::vector<std::optional<std::string>> values;
+		};
+
 		/**
 		 * An environnment value
 		 */
@@ -26,20 +73,87 @@ namespace langgen {
 			/**
 			 * The actual runtime value
 			 */
-			std::shared_ptr<langgen::values::RuntimeValue> value;
+			langgen::values::Value value;
 			/**
 			 * The value properties
 			 */
-			std::unordered_map<std::string, std::string> properties;
+			Properties properties;
 		} EnvValue;
 
+		/**
+		 * The location of a value in an environment chain
+		 */
+		typedef struct SlotAddress {
+			/**
+			 * The number of parents to walk up from the current environment
+			 */
+			size_t depth;
+			/**
+			 * The index of the value in the environment
+			 */
+			size_t slot;
+		} SlotAddress;
+
+		typedef std::function<bool (const EnvValue&)> EnvValidationFunction;
+
 		typedef struct EnvValidationRule {
-			std::function<bool (EnvValue)> validationFunction;
+			EnvValidationFunction validationFunction;
 			std::vector<ValidationRuleSensitivity> sensitivity;
 		} EnvValidationRule;
 
 		#pragma region Classes
 
+		/**
+		 * The compiled properties and validation rules of environments, shared by every scope of an interpreter
+		 * @note Always held by a std::shared_ptr, the properties it compiles hold it too
+		 */
+		class EnvSchema : public std::enable_shared_from_this<EnvSchema> {
+		public:
+			/**
+			 * Compile a new Environment Schema
+			 */
+			EnvSchema(std::vector<std::string> envValuesProperties, std::vector<EnvValidationRule> validationRules = std::vector<EnvValidationRule>());
+
+			/**
+			 * Get the id of a property
+			 * @return The id of the property, or nothing if it is not declared
+			 */
+			std::optional<size_t> property_id(const std::string& name) const;
+
+			/**
+			 * Get the number of declared properties
+			 */
+			size_t property_count() const;
+
+			/**
+			 * Compile properties given by name
+			 * @throws std::runtime_error if a property is not declared
+			 */
+			Properties make_properties(const std::unordered_map<std::string, std::string>& properties) const;
+
+			const std::vector<EnvValidationFunction>& get_init_validation_functions() const;
+			const std::vector<EnvValidationFunction>& get_set_validation_functions() const;
+			const std::vector<EnvValidationFunction>& get_get_validation_functions() const;
+
+		private:
+			/**
+			 * The id of every declared property
+			 */
+			std::unordered_map<std::string, size_t> propertyIds;
+			/**
+			 * The validation functions of the rules sensitive to INIT
+			 */
+			std::vector<EnvValidationFunction> initValidationFunctions;
+			/**
+			 * The validation functions of the rules sensitive to SET
+			 */
+			std::vector<EnvValidationFunction> setValidationFunctions;
+			/**
+			 * The validation functions of the rules sensitive to GET, reads skip validation entirely when empty
+			 */
+			std::vector<EnvValidationFunction> getValidationFunctions;
+		};
+
 		/**
 		 * An Environment
 		 */
@@ -50,10 +164,26 @@ namespace langgen {
 			 */
 			Environment(std::vector<std::string> envValuesProperties, std::vector<EnvValidationRule> validationRules = std::vector<EnvValidationRule>(), std::shared_ptr<Environment> parent = nullptr);
 
+			/**
+			 * Create a new Environment from a compiled schema
+			 * @note Nothing is copied, use this constructor for short-lived scopes
+			 */
+			Environment(std::shared_ptr<const EnvSchema> schema, std::shared_ptr<Environment> parent = nullptr);
+
+			/**
+			 * Get the schema of the environment
+			 */
+			const std::shared_ptr<const EnvSchema>& get_schema();
+
+			/**
+			 * Get the key of every slot of the environment, empty for the slots not initialized yet
+			 */
+			const std::vector<std::string>& get_keys();
+
 			/**
 			 * Check whether this environment has a given key (variable / constant)
 			 */
-			bool has_value(std::string key);
+			bool has_value(const std::string& key);
 
 			/**
 			 * Set a value in the environment or its parents
@@ -62,7 +192,18 @@ namespace langgen {
 			 * @return The result value
 			 */
 			std::shared_ptr<langgen::values::RuntimeValue> set_value(
-				std::string key,
+				const std::string& key,
+				std::shared_ptr<langgen::values::RuntimeValue> value
+			);
+
+			/**
+			 * Set a value at a resolved address in the environment chain
+			 * @param address The address of the value
+			 * @param value The value to set
+			 * @return The result value
+			 */
+			std::shared_ptr<langgen::values::RuntimeValue> set_value_at(
+				SlotAddress address,
 				std::shared_ptr<langgen::values::RuntimeValue> value
 			);
 			
@@ -71,9 +212,24 @@ namespace langgen {
 			 * @param key The key of the value
 			 * @param value The value
 			 * @param isMutable Whether the value is mutable
+			 * @note Takes the slot after the last one, pass the environment to `langgen::resolver::resolve` for the programs evaluated in it afterwards
 			 */
 			std::shared_ptr<langgen::values::RuntimeValue> init_value(
-				std::string key,
+				const std::string& key,
+				std::shared_ptr<langgen::values::RuntimeValue> value,
+				std::unordered_map<std::string, std::string> properties
+			);
+
+			/**
+			 * Initialize a value at a given key, in a slot reserved by a resolver
+			 * @param slot The slot of the value
+			 * @param key The key of the value
+			 * @param value The value
+			 * @param properties The value properties
+			 */
+			std::shared_ptr<langgen::values::RuntimeValue> init_value_at(
+				size_t slot,
+				const std::string& key,
 				std::shared_ptr<langgen::values::RuntimeValue> value,
 				std::unordered_map<std::string, std::string> properties
 			);
@@ -83,7 +239,98 @@ namespace langgen {
 			 * @param key The key of the value
 			 * @return The value
 			 */
-			std::shared_ptr<langgen::values::RuntimeValue> get_value(std::string key);
+			std::shared_ptr<langgen::values::RuntimeValue> get_value(const std::string& key);
+
+			/**
+			 * Get a value at a resolved address in the environment chain, without any key lookup
+			 * @param address The address of the value
+			 * @return The value
+			 */
+			std::shared_ptr<langgen::values::RuntimeValue> get_value_at(SlotAddress address);
+
+			/**
+			 * Set a value in the environment or its parents, without boxing it
+			 * @param key The key to set the value for
+			 * @param value The value to set
+			 * @return The old value
+			 */
+			langgen::values::Value set(const std::string& key, const langgen::values::Value& value);
+
+			/**
+			 * Set a value at a resolved address in the environment chain, without boxing it
+			 * @param address The address of the value
+			 * @param value The value to set
+			 * @return The old value
+			 */
+			langgen::values::Value set_at(SlotAddress address, const langgen::values::Value& value);
+
+			/**
+			 * Initialize a value at a given key, without boxing it
+			 * @param key The key of the value
+			 * @param value The value
+			 * @param properties The value properties
+			 * @note Takes the slot after the last one, pass the environment to `langgen::resolver::resolve` for the programs evaluated in it afterwards
+			 */
+			langgen::values::Value init(
+				const std::string& key,
+				const langgen::values::Value& value,
+				std::unordered_map<std::string, std::string> properties
+			);
+
+			/**
+			 * Initialize a value in a slot reserved by a resolver, without boxing it
+			 * @param slot The slot of the value
+			 * @param key The key of the value
+			 * @param value The value
+			 * @param properties The value properties
+			 */
+			langgen::values::Value init_at(
+				size_t slot,
+				const std::string& key,
+				const langgen::values::Value& value,
+				std::unordered_map<std::string, std::string> properties
+			);
+
+			/**
+			 * Initialize a value at a given key, with properties compiled by the schema of the environment
+			 * @param key The key of the value
+			 * @param value The value
+			 * @param properties The value properties
+			 * @note Takes the slot after the last one, pass the environment to `langgen::resolver::resolve` for the programs evaluated in it afterwards
+			 */
+			langgen::values::Value init(
+				const std::string& key,
+				const langgen::values::Value& value,
+				Properties properties
+			);
+
+			/**
+			 * Initialize a value in a slot reserved by a resolver, with properties compiled by the schema of the environment
+			 * @param slot The slot of the value
+			 * @param key The key of the value
+			 * @param value The value
+			 * @param properties The value properties
+			 */
+			langgen::values::Value init_at(
+				size_t slot,
+				const std::string& key,
+				const langgen::values::Value& value,
+				Properties properties
+			);
+
+			/**
+			 * Get a value at a given key in the environment or its parents, without boxing it
+			 * @param key The key of the value
+			 * @return The value
+			 */
+			langgen::values::Value get(const std::string& key);
+
+			/**
+			 * Get a value at a resolved address in the environment chain, without boxing it
+			 * @param address The address of the value
+			 * @return The value
+			 */
+			langgen::values::Value get_at(SlotAddress address);
 			
 		private:
 			/**
@@ -91,13 +338,49 @@ namespace langgen {
 			 */
 			std::shared_ptr<Environment> parent = nullptr;
 			/**
-			 * The values held by the environment (variables / constants)
+			 * The values held by the environment (variables / constants), indexed by slot
+			 */
+			std::vector<EnvValue> values;
+			/**
+			 * The key of every slot, empty for slots that are not initialized yet
+			 */
+			std::vector<std::string> keys;
+			/**
+			 * The slot of every key held by the environment
+			 */
+			std::unordered_map<std::string, size_t> slots;
+			/**
+			 * Whether every slot was declared by key (`init`), resolved declarations (`init_at`) take these slots over
+			 */
+			std::vector<bool> keyedSlots;
+
+			/**
+			 * The compiled properties and validation rules
 			 */
-			std::unordered_map<std::string, EnvValue> values;
+			std::shared_ptr<const EnvSchema> schema;
 
-			std::vector<std::string> envValuesProperties;
+			/**
+			 * Walk up the environment chain to the environment holding a resolved address
+			 */
+			Environment& resolve(SlotAddress address);
+
+			/**
+			 * Walk up the environment chain to the environment holding a key
+			 * @param slot Set to the slot of the key in the returned environment
+			 * @return The environment, nullptr if the key is not declared
+			 */
+			Environment* find(const std::string& key, size_t& slot);
+
+			langgen::values::Value set_slot(size_t slot, const langgen::values::Value& value);
+
+			langgen::values::Value init_slot(
+				size_t slot,
+				const std::string& key,
+				const langgen::values::Value& value,
+				Properties properties
+			);
 
-			std::vector<EnvValidationRule> validationRules;
+			const langgen::values::Value& get_slot(size_t slot);
 		};
 
 		#pragma endregion
@@ -0,0 +1,296 @@
+#ifndef __LANGGEN_GRAMMAR__
+#define __LANGGEN_GRAMMAR__
+
+#include <AquIce/langgen/lexer.hpp>
+#include <AquIce/langgen/parser.hpp>
+#include <AquIce/langgen/interpreter.hpp>
+#include <AquIce/langgen/stats.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * Grammars fixed at build time, given as types instead of `std::function` tables
+ * @note Every call is direct and can be inlined, use the runtime `Lexer`, `Parser` and `Interpreter` for grammars configured at runtime
+ * @note The tokens, nodes and environments are the ones of the runtime API, both can be mixed
+ */
+namespace langgen {
+	namespace grammar {
+
+		/**
+		 * The skipped characters and comments of a static lexer, the same as the defaults of `setup_lexer`
+		 * @note A configuration is any type with the same static members
+		 */
+		struct DefaultLexerConfig {
+			static constexpr std::string_view whitespaces = " \t\n\r";
+			static constexpr std::string_view singleLineComment = "//";
+			static constexpr std::string_view multiLineCommentOpen = "/*";
+			static constexpr std::string_view multiLineCommentClose = "*/";
+		};
+
+		/**
+		 * Whether a token type is a literal (has a static `literal` member), or is matched by a static `match` function
+		 */
+		template <typename T, typename = void>
+		struct is_literal_token : std::false_type {};
+
+		template <typename T>
+		struct is_literal_token<T, std::void_t<decltype(T::literal)>> : std::true_type {};
+
+		/**
+		 * Get the interned kind of a token type
+		 */
+		template <typename TokenType>
+		langgen::lexer::TokenKind token_kind() {
+			static const langgen::lexer::TokenKind kind = langgen::lexer::token_kind(std::string(TokenType::name));
+			return kind;
+		}
+
+		/**
+		 * Get the interned kind of the node type evaluated by an evaluator
+		 */
+		template <typename Evaluator>
+		langgen::ast::NodeKind node_kind() {
+			static const langgen::ast::NodeKind kind = langgen::ast::node_kind(std::string(Evaluator::type));
+			return kind;
+		}
+
+		/**
+		 * Get a statement as its node class, without any runtime check
+		 * @note Only valid once the kind of the statement is known, as in the evaluators of a `StaticInterpreter`
+		 */
+		template <typename T>
+		T& node_as(const std::shared_ptr<langgen::ast::Statement>& statement) {
+			return static_cast<T&>(*statement);
+		}
+
+		/**
+		 * A lexer generated from a list of token types, tried in declaration order, the first matching one is kept
+		 * @note A token type has a static `name`, and either a static `literal` or a static `size_t match(std::string_view)`
+		 * returning the length of the match, 0 if it does not match
+		 */
+		template <typename Config, typename... TokenTypes>
+		class StaticLexer {
+		public:
+			/**
+			 * Lex a source into a list of tokens, giving the same tokens as `langgen::lexer::lex` with the same token types
+			 * @param stats The stats to record the lexing time and the tokens produced in, if any
+			 */
+			static void lex(
+				std::vector<langgen::lexer::Token>& tokens,
+				std::string_view src,
+				langgen::stats::Stats* stats = nullptr
+			) {
+				langgen::stats::PhaseRecorder recorder(stats, langgen::stats::Phase::LEX);
+
+				size_t position = 0;
+
+				while(position < src.length()) {
+					if(Config::whitespaces.find(src[position]) != std::string_view::npos) {
+						position++;
+						continue;
+					}
+
+					std::string_view rest = src.substr(position);
+
+					if(Config::singleLineComment.length() != 0 && rest.substr(0, Config::singleLineComment.length()) == Config::singleLineComment) {
+						size_t end = src.find('\n', position);
+						position = end == std::string_view::npos ? src.length() : end;
+						continue;
+					}
+					if(Config::multiLineCommentOpen.length() != 0 && rest.substr(0, Config::multiLineCommentOpen.length()) == Config::multiLineCommentOpen) {
+						size_t end = src.find(Config::multiLineCommentClose, position);
+						if(end == std::string_view::npos) {
+							throw std::runtime_error("Comment being opened and not closed before EOF");
+						}
+						position = end + Config::multiLineCommentClose.length();
+						continue;
+					}
+					if(Config::multiLineCommentClose.length() != 0 && rest.substr(0, Config::multiLineCommentClose.length()) == Config::multiLineCommentClose) {
+						throw std::runtime_error("Comment being closed without being opened");
+					}
+
+					size_t length = 0;
+					if(!(StaticLexer::lex_token<TokenTypes>(tokens, rest, position, length) || ...)) {
+						throw std::runtime_error("Unknown token in \"" + std::string(rest) + "\"");
+					}
+					position += length;
+				}
+
+				tokens.push_back(langgen::lexer::Token{
+					"EOF",
+					"",
+					langgen::lexer::EOF_TOKEN_KIND,
+					src.length()
+				});
+			}
+
+		private:
+			template <typename TokenType>
+			static bool lex_token(
+				std::vector<langgen::lexer::Token>& tokens,
+				std::string_view rest,
+				size_t position,
+				size_t& length
+			) {
+				if constexpr (is_literal_token<TokenType>::value) {
+					if(rest.substr(0, TokenType::literal.length()) != TokenType::literal) {
+						return false;
+					}
+					length = TokenType::literal.length();
+				} else {
+					length = TokenType::match(rest);
+				}
+
+				if(length == 0) {
+					return false;
+				}
+
+				LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->tokens, token_kind<TokenType>()));
+				tokens.push_back(langgen::lexer::Token{
+					std::string(TokenType::name),
+					std::string(rest.substr(0, length)),
+					token_kind<TokenType>(),
+					position
+				});
+				return true;
+			}
+		};
+
+		/**
+		 * A parser generated from a list of top nodes, tried in declaration order
+		 * @note A node has a static `key` (used by the stats) and a static `std::shared_ptr<langgen::ast::Statement> parse(TokenStream&)`
+		 * returning nullptr if it does not match
+		 * @note The token stream has no `Parser`, nodes call each other directly instead of through `parse_node`, and are not memoized
+		 */
+		template <typename... TopNodes>
+		class StaticParser {
+		public:
+			static std::shared_ptr<langgen::ast::Statement> parse_statement(langgen::parser::TokenStream& tokens) {
+				size_t start = langgen::parser::mark(tokens);
+				std::shared_ptr<langgen::ast::Statement> statement;
+
+				if(!(StaticParser::parse_node<TopNodes>(tokens, start, statement) || ...)) {
+					throw std::runtime_error("Unknown token : \"" + peek(tokens).type + "\"");
+				}
+				return statement;
+			}
+
+			/**
+			 * Parse a program from a token stream, as `langgen::parser::parse` does
+			 * @param stats The stats to record the parsing time and the attempts of the nodes in, if any
+			 * @note The nodes are allocated in the arena of the token stream, if any
+			 */
+			static void parse(
+				std::shared_ptr<langgen::ast::Scope> program,
+				langgen::parser::TokenStream& tokens,
+				langgen::stats::Stats* stats = nullptr
+			) {
+				langgen::stats::PhaseRecorder recorder(stats, langgen::stats::Phase::PARSE);
+
+				while(peek(tokens).kind != langgen::lexer::EOF_TOKEN_KIND) {
+					size_t start = langgen::parser::mark(tokens);
+					program->body.push_back(StaticParser::parse_statement(tokens));
+					program->spans.push_back(langgen::ast::TokenSpan{start, langgen::parser::mark(tokens)});
+					if(tokens.source != nullptr) {
+						langgen::parser::compact(tokens);
+					}
+				}
+			}
+
+			static void parse(
+				std::shared_ptr<langgen::ast::Scope> program,
+				std::vector<langgen::lexer::Token>& tokens,
+				langgen::stats::Stats* stats = nullptr
+			) {
+				langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+				StaticParser::parse(program, stream, stats);
+				langgen::parser::compact(stream);
+			}
+
+		private:
+			template <typename Node>
+			static bool parse_node(
+				langgen::parser::TokenStream& tokens,
+				size_t start,
+				std::shared_ptr<langgen::ast::Statement>& statement
+			) {
+				statement = Node::parse(tokens);
+				LANGGEN_STATS_RECORD(stats, langgen::stats::count_node(*stats, std::string(Node::key), statement != nullptr));
+				if(statement == nullptr) {
+					langgen::parser::reset(tokens, start);
+					return false;
+				}
+				return true;
+			}
+		};
+
+		/**
+		 * An evaluator generated from a list of evaluators, dispatching on the kind of the statements
+		 * @note An evaluator has a static `type` (the NodeType it evaluates) and a static
+		 * `template <typename Interpreter> langgen::values::Value evaluate(const std::shared_ptr<langgen::ast::Statement>&, const std::shared_ptr<langgen::env::Environment>&)`,
+		 * evaluating the children of the node with `Interpreter::evaluate`
+		 */
+		template <typename... Evaluators>
+		class StaticInterpreter {
+		public:
+			/**
+			 * Evaluate a statement
+			 * @throws std::runtime_error if no evaluator evaluates the type of the statement
+			 */
+			static langgen::values::Value evaluate(
+				const std::shared_ptr<langgen::ast::Statement>& statement,
+				const std::shared_ptr<langgen::env::Environment>& env
+			) {
+				langgen::ast::NodeKind kind = statement->kind();
+				langgen::values::Value result;
+
+				LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->evaluations, kind));
+
+				if(!(StaticInterpreter::evaluate_node<Evaluators>(kind, statement, env, result) || ...)) {
+					throw std::runtime_error("Trying to evaluate unknown statement " + statement->type());
+				}
+				return result;
+			}
+
+			/**
+			 * Interpret a program, recording the results of its statements in a sink
+			 * @param env The environment of the program, see `langgen::interpreter::get_env_schema` to create it from the schema of an interpreter
+			 * @param stats The stats to record the interpretation time, the evaluations, the environment lookups and the validations in, if any
+			 */
+			static void interpret(
+				langgen::interpreter::ResultSink& sink,
+				std::shared_ptr<langgen::ast::Scope> program,
+				std::shared_ptr<langgen::env::Environment> env,
+				langgen::stats::Stats* stats = nullptr
+			) {
+				langgen::stats::PhaseRecorder recorder(stats, langgen::stats::Phase::INTERPRET);
+
+				for(const std::shared_ptr<langgen::ast::Statement>& statement : program->body) {
+					langgen::interpreter::record_result(sink, statement, StaticInterpreter::evaluate(statement, env));
+				}
+			}
+
+		private:
+			template <typename Evaluator>
+			static bool evaluate_node(
+				langgen::ast::NodeKind kind,
+				const std::shared_ptr<langgen::ast::Statement>& statement,
+				const std::shared_ptr<langgen::env::Environment>& env,
+				langgen::values::Value& result
+			) {
+				if(kind != node_kind<Evaluator>()) {
+					return false;
+				}
+				result = Evaluator::template evaluate<StaticInterpreter>(statement, env);
+				return true;
+			}
+		};
+	}
+}
+
+#endif // __LANGGEN_GRAMMAR__
@@ -21,26 +21,132 @@ namespace langgen {
 			std::shared_ptr<langgen::ast::Statement>,
 			std::shared_ptr<langgen::env::Environment>
 		)> ParseStatementFunction;
+
+		/**
+		 * An evaluation function working on unboxed values
+		 * @note Numbers, booleans and null go through it without any allocation nor reference counting
+		 */
+		typedef std::function<langgen::values::Value (
+			langgen::interpreter::Interpreter&,
+			const std::shared_ptr<langgen::ast::Statement>&,
+			const std::shared_ptr<langgen::env::Environment>&
+		)> EvaluateValueFunction;
 		
+		/**
+		 * Which results of the top-level statements are recorded
+		 */
+		enum class ResultPolicy {
+			/**
+			 * Record nothing
+			 */
+			NONE,
+			/**
+			 * Record the result of the last statement only
+			 */
+			LAST,
+			/**
+			 * Record the result of every statement, in evaluation order
+			 */
+			ORDERED
+		};
+
+		/**
+		 * The result of a top-level statement
+		 */
+		typedef struct StatementResult {
+			std::shared_ptr<langgen::ast::Statement> statement;
+			langgen::values::Value value;
+		} StatementResult;
+
+		/**
+		 * Where the results of the top-level statements are recorded
+		 * @note Nothing is rendered to strings, see `render_results`
+		 */
+		typedef struct ResultSink {
+			ResultPolicy policy = ResultPolicy::NONE;
+			std::vector<StatementResult> results;
+		} ResultSink;
+
 		typedef struct Interpreter {
 			std::unordered_map<std::string, ParseStatementFunction> nodeEvaluationFunctions;
 			std::vector<std::string> envValuesProperties;
 			std::vector<langgen::env::EnvValidationRule> validationRules;
+			/**
+			 * The schema shared by every environment, compiled from `envValuesProperties` and `validationRules` by `compile_env_schema`
+			 */
+			std::shared_ptr<const langgen::env::EnvSchema> envSchema;
+			/**
+			 * The evaluation functions indexed by NodeKind, compiled from `nodeEvaluationFunctions`
+			 */
+			std::vector<ParseStatementFunction> evaluationTable;
+			/**
+			 * The evaluation functions working on unboxed values, preferred over `nodeEvaluationFunctions` by `evaluate_value`
+			 */
+			std::unordered_map<std::string, EvaluateValueFunction> nodeValueEvaluationFunctions;
+			/**
+			 * The value evaluation functions indexed by NodeKind, compiled from `nodeValueEvaluationFunctions`
+			 */
+			std::vector<EvaluateValueFunction> valueEvaluationTable;
 		} Interpreter;
 
+		/**
+		 * Compile the evaluation functions of an interpreter into tables indexed by NodeKind
+		 * @param interpreter The interpreter to compile
+		 * @note Called by `setup_interpreter`, call it again after adding functions to the maps
+ * @note Evaluation never writes the tables, functions added later are looked up in the maps on each evaluation until recompiled
+		 */
+		void compile_evaluation_functions(Interpreter& interpreter);
+
+		/**
+		 * Compile the environment schema of an interpreter from its properties and validation rules
+		 * @param interpreter The interpreter to compile
+		 * @note Called by `setup_interpreter`, call it again after modifying `envValuesProperties` or `validationRules` directly
+		 * @note Environments created before keep the schema they were created with
+		 */
+		void compile_env_schema(Interpreter& interpreter);
+
+		/**
+		 * Get the environment schema of an interpreter, compiling it if the interpreter was not set up
+		 */
+		const std::shared_ptr<const langgen::env::EnvSchema>& get_env_schema(Interpreter& interpreter);
+
+		/**
+		 * Record the result of a top-level statement in a sink, according to its policy
+		 */
+		void record_result(
+			ResultSink& sink,
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const langgen::values::Value& value
+		);
+
 		void setup_interpreter(
 			Interpreter& interpreter,
 			std::unordered_map<std::string, ParseStatementFunction> nodeEvaluationFunctions,
 			std::vector<std::string> envValuesProperties,
-			std::vector<langgen::env::EnvValidationRule> validationRules
+			std::vector<langgen::env::EnvValidationRule> validationRules,
+			std::unordered_map<std::string, EvaluateValueFunction> nodeValueEvaluationFunctions = std::unordered_map<std::string, EvaluateValueFunction>()
 		);
 
+		/**
+		 * Evaluate a statement to a boxed runtime value
+		 * @note Falls back to the value evaluation function of the statement, boxing its result
+		 */
 		std::shared_ptr<langgen::values::RuntimeValue> evaluate_statement(
 			Interpreter& interpreter,
 			std::shared_ptr<langgen::ast::Statement> statement,
 			std::shared_ptr<langgen::env::Environment> env
 		);
 
+		/**
+		 * Evaluate a statement to an unboxed value
+		 * @note Falls back to the evaluation function of the statement, unboxing its result
+		 */
+		langgen::values::Value evaluate_value(
+			Interpreter& interpreter,
+			const std::shared_ptr<langgen::ast::Statement>& statement,
+			const std::shared_ptr<langgen::env::Environment>& env
+		);
+
 		std::shared_ptr<langgen::values::RuntimeValue> evaluate_scope(
 			Interpreter& interpreter,
 			std::shared_ptr<langgen::ast::Scope> scope,
@@ -49,10 +155,44 @@ namespace langgen {
 			std::shared_ptr<langgen::env::Environment> parent_env = nullptr
 		);
 
+		/**
+		 * Evaluate a scope, recording the results of its statements in a sink
+		 * @return The result of the last statement, null if the scope is empty
+		 */
+		langgen::values::Value evaluate_scope(
+			Interpreter& interpreter,
+			std::shared_ptr<langgen::ast::Scope> scope,
+			ResultSink& sink,
+			std::shared_ptr<langgen::env::Environment> scope_env = nullptr,
+			std::shared_ptr<langgen::env::Environment> parent_env = nullptr
+		);
+
 		void interpret(
 			Interpreter& interpreter,
 			std::unordered_map<std::string, std::string>& results, 
-			std::shared_ptr<langgen::ast::Scope> program
+			std::shared_ptr<langgen::ast::Scope> program,
+			langgen::stats::Stats* stats = nullptr
+		);
+
+		/**
+		 * Interpret a program, recording the results of its statements in a sink
+		 * @param sink The sink to record the results in, according to its policy
+		 * @param stats The stats to record the interpretation time, the evaluations, the environment lookups and the validations in, if any
+		 */
+		void interpret(
+			Interpreter& interpreter,
+			ResultSink& sink,
+			std::shared_ptr<langgen::ast::Scope> program,
+			langgen::stats::Stats* stats = nullptr
+		);
+
+		/**
+		 * Render recorded results as a map of statement representations to value representations
+		 * @note Identical statements overwrite each other
+		 */
+		void render_results(
+			const ResultSink& sink,
+			std::unordered_map<std::string, std::string>& results
 		);
 	}
 }
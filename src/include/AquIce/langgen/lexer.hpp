@@ -1,12 +1,22 @@
 #ifndef __LANGGEN_LEXER__
 #define __LANGGEN_LEXER__
 
+#include <AquIce/langgen/source.hpp>
+#include <AquIce/langgen/stats.hpp>
+
 #include <iostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <stdexcept>
 #include <functional>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <exception>
+#include <iterator>
+#include <array>
 
 /**
  * Peek at the first character a string
@@ -41,15 +51,106 @@
  */
 bool startswith(std::string str, std::string substr);
 
+/**
+ * Check if a string view starts with a substring, without copying either of them
+ * @param str The string view to check in
+ * @param substr The substring to look for
+ * @return Whether `str` starts with `substr`
+ */
+bool startswith(std::string_view str, std::string_view substr);
+
 namespace langgen {
 	namespace lexer {
+		/**
+		 * A dense integer id identifying a token type name
+		 */
+		typedef size_t TokenKind;
+
+		/**
+		 * The kind of the `EOF` token appended by `lex`
+		 */
+		const TokenKind EOF_TOKEN_KIND = 0;
+
+		/**
+		 * The kind of a token or token type whose name has not been interned
+		 */
+		const TokenKind NO_TOKEN_KIND = static_cast<TokenKind>(-1);
+
+		/**
+		 * The character class of the whitespaces of a lexer
+		 */
+		const unsigned char WHITESPACE_CHAR = 1;
+
+		/**
+		 * The character class of the first characters of the comment delimiters of a lexer
+		 */
+		const unsigned char COMMENT_CHAR = 2;
+
+		/**
+		 * Get the kind of a token type name, interning it on first use
+		 * @param name The name of the token type
+		 * @return The kind
+		 */
+		TokenKind token_kind(const std::string& name);
+
+		/**
+		 * Get the name of an interned token kind
+		 * @param kind The kind
+		 * @return The name of the token type
+		 */
+		const std::string& token_kind_name(TokenKind kind);
+
+		/**
+		 * Lex a token value at the start of a source
+		 * @note Returns the lexed value, or an empty string if the token does not match
+		 */
+		typedef std::function<std::string(std::string)> LexTokenFunction;
+
+		/**
+		 * Match a token at the start of a source without copying it
+		 * @note Returns the length of the match, or 0 if the token does not match
+		 */
+		typedef std::function<size_t(std::string_view)> MatchTokenFunction;
+
 		typedef struct TokenType {
 			std::string name;
-			std::function<std::string(std::string)> lex_token;
+			LexTokenFunction lex_token;
+			MatchTokenFunction match_token;
+			/**
+			 * The literal value of the token type
+			 * @note Only set by the literal `make_token_type` overloads, empty for custom lexing functions
+			 */
+			std::string literal;
+			/**
+			 * The interned kind of `name`
+			 */
+			TokenKind kind = NO_TOKEN_KIND;
 		} TokenType;
 
+		/**
+		 * A node of the literal token types prefix trie
+		 */
+		typedef struct TokenTrieNode {
+			/**
+			 * The children of the node, sorted by character
+			 */
+			std::vector<std::pair<char, size_t>> children;
+			/**
+			 * The index of the first declared token type whose literal ends at this node
+			 */
+			size_t tokenType = std::string::npos;
+		} TokenTrieNode;
+
 		typedef struct Lexer {
 			std::vector<TokenType> tokenTypes;
+			/**
+			 * The prefix trie of every literal token type, the root is the first node
+			 */
+			std::vector<TokenTrieNode> literalTrie;
+			/**
+			 * The indexes of the custom token types, in declaration order
+			 */
+			std::vector<size_t> customTokenTypes;
 			std::vector<char> whitespaces = std::vector<char>({
 				' ',
 				'\t',
@@ -62,11 +163,26 @@ namespace langgen {
 			char charDelimiter = '\'';
 			char stringDelimiter = '"';
 			char escapeCharacter = '\\';
+			/**
+			 * The classes of every character (`WHITESPACE_CHAR`, `COMMENT_CHAR`), indexed by unsigned character
+			 * @note Compiled from `whitespaces` and the comment delimiters by `compile_token_types`
+			 */
+			std::array<unsigned char, 256> charClasses = {};
 		} Lexer;
 
 		typedef struct Token {
 			std::string type;
 			std::string value;
+			/**
+			 * The interned kind of `type`, to match on instead of comparing strings
+			 * @note Left to NO_TOKEN_KIND in tokens built by hand, the parser interns it when peeking them
+			 */
+			TokenKind kind = NO_TOKEN_KIND;
+			/**
+			 * The position of the token in the source, in bytes
+			 * @note The value of the token is `src.substr(offset, value.length())`, use it to view the source (for example a `MappedSource`) instead of copying values
+			 */
+			size_t offset = 0;
 		} Token;
 
 		std::string repr(const Token& token);
@@ -75,7 +191,17 @@ namespace langgen {
 
 		TokenType make_token_type(std::string name, std::string value);
 
-		TokenType make_token_type(std::string name, std::function<std::string(std::string)> lex_token);
+		TokenType make_token_type(std::string name, LexTokenFunction lex_token);
+
+		TokenType make_token_type(std::string name, MatchTokenFunction match_token);
+
+		/**
+		 * Compile the token types of a lexer into a literal prefix trie and a list of custom token types,
+		 * and its whitespaces and comment delimiters into character classes
+		 * @param lexer The lexer to compile
+		 * @note Called by `setup_lexer`, call it again after modifying `tokenTypes`, `whitespaces` or the comment delimiters directly
+		 */
+		void compile_token_types(Lexer& lexer);
 
 		void setup_lexer(
 			Lexer& lexer,
@@ -94,11 +220,157 @@ namespace langgen {
 			char escapeCharacter = '\\'
 		);
 
+		/**
+		 * Lex a source into a list of tokens
+		 * @param lexer The configured lexer
+		 * @param tokens The list to append the tokens to
+		 * @param src The source to lex
+		 * @param stats The stats to record the lexing time and the tokens produced in, if any
+		 * @note The source is never copied, a cursor walks it from start to end
+		 */
 		void lex(
 			Lexer& lexer,
 			std::vector<Token>& tokens,
-			std::string src
+			std::string_view src,
+			langgen::stats::Stats* stats = nullptr
 		);
+
+		/**
+		 * Lex a file, mapped in memory instead of being read
+		 * @param path The path of the file
+		 * @note Keep a `MappedSource` alive and lex its view instead to reference the source through the token offsets
+		 */
+		void lex_file(
+			Lexer& lexer,
+			std::vector<Token>& tokens,
+			const std::string& path
+		);
+
+		/**
+		 * The smallest chunk of source lexed on its own thread by `lex_parallel`
+		 */
+		const size_t PARALLEL_LEX_MIN_CHUNK = 64 * 1024;
+
+		/**
+		 * Lex a source on several threads, giving the same tokens as `lex`
+		 * @param threads The number of threads to use, 0 to use every hardware thread
+		 * @note The source is split at newlines outside of comments and char / string delimiters (using the lexer settings),
+		 * so custom token types must not match newlines outside of delimiters, and must be safe to call from several threads
+		 * @note If any chunk fails, the whole source is lexed again sequentially to report the same error as `lex`
+		 */
+		void lex_parallel(
+			Lexer& lexer,
+			std::vector<Token>& tokens,
+			std::string_view src,
+			size_t threads = 0
+		);
+
+		/**
+		 * A replacement of a range of a source by a new text, or of a range of tokens or statements by new ones
+		 */
+		typedef struct Edit {
+			/**
+			 * The start of the replaced range
+			 */
+			size_t offset;
+			/**
+			 * The length of the replaced range, before the edit
+			 */
+			size_t removed;
+			/**
+			 * The length of the new range, after the edit
+			 */
+			size_t inserted;
+		} Edit;
+
+		/**
+		 * Lex the range of a source touched by an edit again, updating the tokens previously lexed from it
+		 * @param tokens The tokens of the source before the edit, ending with the `EOF` token
+		 * @param src The source after the edit
+		 * @param edit The edit of the source, in bytes
+		 * @return The edit of the tokens, the tokens outside of it are kept and only have their offset shifted
+		 * @note Lexing starts again two tokens before the edit (in case a custom token type looks past its own end),
+		 * and stops at the first new token after the edit starting where an old token started, the rest of the source being unchanged
+		 * @throws std::runtime_error if the edited range can not be lexed, the tokens are then left untouched
+		 */
+		Edit relex(
+			Lexer& lexer,
+			std::vector<Token>& tokens,
+			std::string_view src,
+			const Edit& edit
+		);
+
+		/**
+		 * Find the end of the longest prefix of a source which can be lexed on its own
+		 * @return The position right after the last newline found outside of comments and char / string delimiters, 0 if there is none
+		 * @note Always 0 if newlines are not whitespaces of the lexer
+		 */
+		size_t safe_prefix_length(
+			const Lexer& lexer,
+			std::string_view src
+		);
+
+		/**
+		 * The number of bytes read at once by a `TokenSource`
+		 */
+		const size_t STREAM_LEX_CHUNK = 64 * 1024;
+
+		/**
+		 * A pull-based source of tokens, reading an input stream or a file descriptor in chunks and lexing them on demand
+		 * @note Each chunk is only lexed up to its last safe newline (see `safe_prefix_length`), the rest is carried over to the next one,
+		 * so the same restrictions as `lex_parallel` apply to custom token types
+		 * @note Only the unlexed rest of the input is buffered, a comment or string is buffered until it is closed
+		 */
+		class TokenSource {
+		public:
+			TokenSource(
+				Lexer& lexer,
+				std::istream& input,
+				size_t chunkSize = STREAM_LEX_CHUNK
+			);
+			TokenSource(
+				Lexer& lexer,
+				int fd,
+				size_t chunkSize = STREAM_LEX_CHUNK
+			);
+
+			TokenSource(const TokenSource&) = delete;
+			TokenSource& operator=(const TokenSource&) = delete;
+
+			/**
+			 * Lex the next tokens of the input, reading as many chunks as needed to get at least one
+			 * @param tokens The list to append the tokens to, with their offsets in the whole input
+			 * @return Whether tokens were appended, false once the `EOF` token has been appended
+			 * @throws std::runtime_error if the input can not be read or lexed
+			 */
+			bool fill(std::vector<Token>& tokens);
+
+			/**
+			 * Check whether the `EOF` token has been appended
+			 */
+			bool done() const;
+
+		private:
+			/**
+			 * Append the next chunk of the input to `pending`
+			 * @return The number of bytes read, 0 at the end of the input
+			 */
+			size_t read_chunk();
+
+			Lexer& lexer;
+			std::istream* input;
+			int fd;
+			size_t chunkSize;
+			/**
+			 * The read and not yet lexed part of the input
+			 */
+			std::string pending;
+			/**
+			 * The number of lexed bytes, the offset of `pending` in the input
+			 */
+			size_t consumed = 0;
+			bool finished = false;
+		};
 	}
 }
 
@@ -0,0 +1,157 @@
+#ifndef __LANGGEN_OPTIMIZER__
+#define __LANGGEN_OPTIMIZER__
+
+#include <AquIce/langgen/ast.hpp>
+#include <AquIce/langgen/values.hpp>
+#include <AquIce/langgen/interpreter.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <functional>
+
+namespace langgen {
+	namespace optimizer {
+
+		struct Optimizer;
+
+		/**
+		 * Rewrite a node, and recursively its children
+		 * @return The node replacing the statement, or the statement itself
+		 */
+		typedef std::function<std::shared_ptr<langgen::ast::Statement> (
+			langgen::optimizer::Optimizer&,
+			const std::shared_ptr<langgen::ast::Statement>&
+		)> FoldStatementFunction;
+
+		/**
+		 * Make the literal node representing a value
+		 * @return The literal, or nullptr if this literal type can not represent the value
+		 */
+		typedef std::function<std::shared_ptr<langgen::ast::Statement> (
+			const langgen::values::Value&
+		)> MakeLiteralFunction;
+
+		/**
+		 * A node type holding a constant value
+		 */
+		typedef struct LiteralType {
+			std::string nodeType;
+			MakeLiteralFunction make_literal;
+		} LiteralType;
+
+		/**
+		 * A rewrite pass over a whole program
+		 */
+		typedef std::function<void (
+			langgen::optimizer::Optimizer&,
+			std::shared_ptr<langgen::ast::Scope>
+		)> PassFunction;
+
+		typedef struct Pass {
+			std::string name;
+			PassFunction run;
+		} Pass;
+
+		/**
+		 * A pass manager rewriting programs between parsing and evaluation
+		 * @note Rewritten statements replace the original ones, results then refer to the rewritten statements
+		 */
+		typedef struct Optimizer {
+			/**
+			 * The interpreter evaluating the constant subtrees
+			 */
+			langgen::interpreter::Interpreter* interpreter;
+			/**
+			 * The passes, run in order
+			 */
+			std::vector<Pass> passes;
+			std::unordered_map<std::string, FoldStatementFunction> nodeFoldFunctions;
+			std::vector<LiteralType> literalTypes;
+			/**
+			 * The constant bindings of the open scopes, from the outermost to the innermost
+			 * @note A binding declared without a constant value is stored as nullptr, hiding the outer ones
+			 */
+			std::vector<std::unordered_map<std::string, std::shared_ptr<langgen::ast::Statement>>> scopes;
+		} Optimizer;
+
+		/**
+		 * Setup an optimizer with a single "fold" pass, folding constant subtrees and propagating constant bindings
+		 * @param nodeFoldFunctions The fold rules of the grammar nodes
+		 * @param literalTypes The literal node types of the grammar, `NumberExpression` is always one
+		 */
+		void setup_optimizer(
+			Optimizer& optimizer,
+			langgen::interpreter::Interpreter& interpreter,
+			std::unordered_map<std::string, FoldStatementFunction> nodeFoldFunctions,
+			std::vector<LiteralType> literalTypes = std::vector<LiteralType>()
+		);
+
+		void add_pass(
+			Optimizer& optimizer,
+			std::string name,
+			PassFunction run
+		);
+
+		/**
+		 * Check whether a statement is a literal
+		 */
+		bool is_literal(
+			Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+
+		/**
+		 * Evaluate a statement whose children are all literals
+		 * @return The literal of its value, or the statement itself if its evaluation fails (the error is then reported at runtime) or no literal represents its value
+		 */
+		std::shared_ptr<langgen::ast::Statement> fold_constant(
+			Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+
+		/**
+		 * Declare a binding in the innermost scope
+		 * @param constant The literal value of the binding, nullptr if it is not constant
+		 */
+		void declare(
+			Optimizer& optimizer,
+			const std::string& key,
+			std::shared_ptr<langgen::ast::Statement> constant
+		);
+
+		/**
+		 * Look a binding up in the open scopes
+		 * @return The literal value of the binding, nullptr if it is not constant or not declared
+		 */
+		std::shared_ptr<langgen::ast::Statement> lookup_constant(
+			Optimizer& optimizer,
+			const std::string& key
+		);
+
+		/**
+		 * Fold a statement
+		 * @note Statements without a fold rule are left untouched
+		 */
+		std::shared_ptr<langgen::ast::Statement> fold_statement(
+			Optimizer& optimizer,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+
+		void fold_scope(
+			Optimizer& optimizer,
+			std::shared_ptr<langgen::ast::Scope> scope
+		);
+
+		/**
+		 * Run every pass over a program
+		 */
+		void optimize(
+			Optimizer& optimizer,
+			std::shared_ptr<langgen::ast::Scope> program
+		);
+	}
+}
+
+#endif // __LANGGEN_OPTIMIZER__
@@ -9,30 +9,215 @@
 #include <memory>
 #include <unordered_map>
 #include <functional>
+#include <atomic>
 
 #define generate_parser(size)
 
+namespace langgen {
+	namespace parser {
+
+		struct Parser;
+
+		/**
+		 * The memoized result of a node at a token position
+		 */
+		typedef struct MemoEntry {
+			/**
+			 * The parsed node, nullptr if the node did not match
+			 */
+			std::shared_ptr<langgen::ast::Statement> statement;
+			/**
+			 * The mark of the token stream after the node was parsed
+			 */
+			size_t end;
+		} MemoEntry;
+
+		/**
+		 * A memoized node and a token position (as given by `mark`)
+		 */
+		typedef std::pair<size_t, size_t> MemoKey;
+
+		typedef struct MemoKeyHash {
+			size_t operator()(const MemoKey& key) const {
+				return std::hash<size_t>()(key.first * 0x9e3779b97f4a7c15ULL ^ key.second);
+			}
+		} MemoKeyHash;
+
+		/**
+		 * A cursor over a list of tokens
+		 * @note Consuming a token only moves the cursor, the list itself is left untouched
+		 */
+		typedef struct TokenStream {
+			/**
+			 * The underlying list of tokens
+			 */
+			std::vector<langgen::lexer::Token>& tokens;
+			/**
+			 * The index of the next token in `tokens`
+			 */
+			size_t position = 0;
+			/**
+			 * The number of consumed tokens erased from the front of `tokens` by `compact`
+			 */
+			size_t base = 0;
+			/**
+			 * The arena to allocate the parsed nodes in, if any
+			 */
+			langgen::ast::Arena* arena = nullptr;
+			/**
+			 * The source lexing the tokens on demand, if any
+			 * @note `tokens` is then a sliding window, refilled by `peek` and `eat` and compacted by `parse` after each top-level statement
+			 */
+			langgen::lexer::TokenSource* source = nullptr;
+			/**
+			 * The parser whose nodes `parse_node` looks up, set by `parse_statement`
+			 */
+			Parser* parser = nullptr;
+			/**
+			 * The results of the memoized nodes, cleared by `parse` after each top-level statement
+			 */
+			std::unordered_map<MemoKey, MemoEntry, MemoKeyHash> memo;
+		} TokenStream;
+
+		/**
+		 * Create a node, in the arena of a token stream if it has one
+		 * @param tokens The token stream being parsed
+		 * @param args The arguments of the node constructor
+		 * @return The node
+		 */
+		template <typename T, typename... Args>
+		std::shared_ptr<T> make_statement(TokenStream& tokens, Args&&... args) {
+			if(tokens.arena != nullptr) {
+				return tokens.arena->make<T>(std::forward<Args>(args)...);
+			}
+			return langgen::ast::make<T>(std::forward<Args>(args)...);
+		}
+	}
+}
+
 [[nodiscard]] langgen::lexer::Token peek(std::vector<langgen::lexer::Token>& tokens);
 
 [[nodiscard]] langgen::lexer::Token eat(std::vector<langgen::lexer::Token>& tokens);
 
+/**
+ * Peek at the next token of a token stream
+ * @param tokens The token stream to peek
+ * @return The next token
+ * @note This function uses `[[nodiscard]]`, you need to explicitly cast the value to `void` if not used
+ * @note If the stream has a source, the returned reference is only valid until the next call to `peek` or `eat`
+ * @note A token without a kind (built by hand) gets the kind of its type
+ */
+[[nodiscard]] const langgen::lexer::Token& peek(langgen::parser::TokenStream& tokens);
+
+/**
+ * Consume the next token of a token stream
+ * @param tokens The token stream to consume from
+ * @return The consumed token
+ * @note This function uses `[[nodiscard]]`, you need to explicitly cast the value to `void` if not used
+ * @note If the stream has a source, the returned reference is only valid until the next call to `peek` or `eat`
+ */
+[[nodiscard]] const langgen::lexer::Token& eat(langgen::parser::TokenStream& tokens);
+
 namespace langgen {
 	namespace parser {
 
+		/**
+		 * Parse a node from a list of tokens, erasing the consumed tokens from its front
+		 */
 		typedef std::function<std::shared_ptr<langgen::ast::Statement> (std::vector<langgen::lexer::Token>&)> ParseNodeFunction;
 
+		/**
+		 * Parse a node from a token stream
+		 */
+		typedef std::function<std::shared_ptr<langgen::ast::Statement> (TokenStream&)> ParseStreamNodeFunction;
+
 		typedef struct Node {
 			ParseNodeFunction parse_node;
 			bool isTopNode;
+			ParseStreamNodeFunction parse_stream_node;
+			/**
+			 * Whether the results of `parse_stream_node` are memoized by token position
+			 */
+			bool memoize = false;
+			/**
+			 * The kinds of the tokens the node can start with, empty if it can start with any token
+			 */
+			std::vector<langgen::lexer::TokenKind> firstKinds;
+			/**
+			 * The priority of the node when several top nodes can start with the same token, higher is tried first
+			 */
+			int priority = 0;
+			/**
+			 * The key of the node in `nodesRegister`, set on the copies made by `compile_dispatch`
+			 */
+			std::string key;
 		} Node;
 
 		typedef struct Parser {
 			std::unordered_map<std::string, Node> nodesRegister;
+			/**
+			 * Whether `parse` allocates the nodes in the arena of the program
+			 * @note Nodes keep the memory of the arena alive, they can outlive the program
+			 * @note `reparse` ignores it, see `reparse`
+			 */
+			bool useArena = false;
+			/**
+			 * The top nodes which can start with each token kind, in dispatch order
+			 * @note Compiled by `compile_dispatch`, from copies of the nodes of `nodesRegister`
+			 */
+			std::unordered_map<langgen::lexer::TokenKind, std::vector<std::shared_ptr<const Node>>> firstDispatch;
+			/**
+			 * The top nodes which can start with any token, in dispatch order
+			 */
+			std::vector<std::shared_ptr<const Node>> anyDispatch;
+			bool dispatchCompiled = false;
 		} Parser;
 
+		/**
+		 * Get a mark of the current position of a token stream, to backtrack to it later
+		 * @param tokens The token stream
+		 * @return The mark
+		 */
+		size_t mark(TokenStream& tokens);
+
+		/**
+		 * Backtrack a token stream to a mark
+		 * @param tokens The token stream
+		 * @param mark The mark to backtrack to
+		 * @note Marks taken before a call to `compact` are invalidated
+		 */
+		void reset(TokenStream& tokens, size_t mark);
+
+		/**
+		 * Get the token at a mark of a token stream
+		 * @param tokens The token stream
+		 * @param mark The mark of the token
+		 * @note Marks taken before a call to `compact` are invalidated
+		 */
+		const langgen::lexer::Token& token_at(TokenStream& tokens, size_t mark);
+
+		/**
+		 * Erase the consumed tokens from the front of the underlying list of a token stream
+		 * @param tokens The token stream
+		 */
+		void compact(TokenStream& tokens);
+
+		/**
+		 * Make a node from a parsing function
+		 * @param memoize Whether to memoize the results of the node by token position (packrat parsing),
+		 * for nodes which are tried again at the same position after backtracking
+		 * @note A memoized node must only depend on the tokens from its position, a match and a failure (nullptr) are both memoized, errors are not
+		 */
 		Node make_node(
 			ParseNodeFunction parse_node,
-			bool isTopNode = true
+			bool isTopNode = true,
+			bool memoize = false
+		);
+
+		Node make_node(
+			ParseStreamNodeFunction parse_stream_node,
+			bool isTopNode = true,
+			bool memoize = false
 		);
 
 		void demoteTopNode(
@@ -42,6 +227,110 @@ namespace langgen {
 
 		std::shared_ptr<langgen::ast::Expression> parse_number_expression(std::vector<langgen::lexer::Token>& tokens);
 
+		std::shared_ptr<langgen::ast::Expression> parse_number_expression(TokenStream& tokens);
+
+		enum class Associativity {
+			LEFT,
+			RIGHT
+		};
+
+		/**
+		 * Build the node of a binary operation
+		 * @param op The operator token
+		 */
+		typedef std::function<std::shared_ptr<langgen::ast::Expression> (
+			TokenStream&,
+			std::shared_ptr<langgen::ast::Expression> left,
+			const langgen::lexer::Token& op,
+			std::shared_ptr<langgen::ast::Expression> right
+		)> BuildBinaryFunction;
+
+		typedef struct BinaryOperator {
+			/**
+			 * The kind of the operator token
+			 */
+			langgen::lexer::TokenKind kind;
+			/**
+			 * The value of the operator token, empty to match any value of the kind
+			 */
+			std::string value;
+			/**
+			 * The precedence of the operator, higher binds tighter
+			 */
+			int precedence;
+			Associativity associativity;
+			BuildBinaryFunction build;
+		} BinaryOperator;
+
+		/**
+		 * The configuration of an operator-precedence expression parser
+		 */
+		typedef struct OperatorTable {
+			std::vector<BinaryOperator> binaryOperators;
+			/**
+			 * Parse an operand, including its prefix operators
+			 */
+			ParseStreamNodeFunction parse_operand;
+		} OperatorTable;
+
+		BinaryOperator make_binary_operator(
+			std::string tokenType,
+			std::string value,
+			int precedence,
+			Associativity associativity,
+			BuildBinaryFunction build
+		);
+
+		/**
+		 * Find the binary operator matching a token
+		 * @return The operator, or nullptr if the token is not a binary operator
+		 */
+		const BinaryOperator* find_binary_operator(
+			const OperatorTable& table,
+			const langgen::lexer::Token& token
+		);
+
+		/**
+		 * Parse a chain of binary operations, following the precedence and associativity of the operators
+		 * @param minPrecedence The precedence below which operators end the expression
+		 * @return The expression, or nullptr if there is no operand
+		 * @note The operations are reduced on a stack, the call depth does not grow with the length of the chain nor the number of precedence levels
+		 * @note The operator tokens are read back from the stream when reducing, `parse_operand` must not erase the tokens it consumes (as nodes with the legacy signature do)
+		 * @throws std::runtime_error if an operator is not followed by an operand
+		 */
+		std::shared_ptr<langgen::ast::Expression> parse_expression(
+			const OperatorTable& table,
+			TokenStream& tokens,
+			int minPrecedence = 0
+		);
+
+		/**
+		 * Declare the token types a node can start with, for `parse_statement` to only try it on these tokens
+		 * @param tokenTypes The names of the token types
+		 */
+		void set_first_tokens(
+			Parser& parser,
+			std::string key,
+			std::vector<std::string> tokenTypes
+		);
+
+		/**
+		 * Set the priority of a node, higher is tried first by `parse_statement`
+		 */
+		void set_priority(
+			Parser& parser,
+			std::string key,
+			int priority
+		);
+
+		/**
+		 * Index the top nodes of a parser by the token kinds they can start with
+		 * @note The candidates of a token kind are the nodes starting with it and the nodes starting with any token,
+		 * sorted by decreasing priority, then by key
+		 * @note Called by the functions modifying the nodes of a parser, call it again after modifying `nodesRegister` directly
+		 */
+		void compile_dispatch(Parser& parser);
+
 		void register_node(
 			Parser& parser,
 			std::string key,
@@ -53,15 +342,75 @@ namespace langgen {
 			std::unordered_map<std::string, Node> nodesRegister
 		);
 
+		/**
+		 * Parse a registered node, through its memo if it is memoized
+		 * @param tokens The token stream, being parsed by `parse_statement`
+		 * @param key The key of the node
+		 * @return The node, or nullptr if it did not match
+		 * @note Call it from parsing functions instead of calling another parsing function directly for the memo of that node to be used
+		 */
+		std::shared_ptr<langgen::ast::Statement> parse_node(
+			TokenStream& tokens,
+			const std::string& key
+		);
+
 		std::shared_ptr<langgen::ast::Statement> parse_statement(
 			Parser& parser,
 			std::vector<langgen::lexer::Token>& tokens
 		);
 
+		std::shared_ptr<langgen::ast::Statement> parse_statement(
+			Parser& parser,
+			TokenStream& tokens
+		);
+
+		/**
+		 * Parse a program from a list of tokens
+		 * @param stats The stats to record the parsing time and the attempts of the nodes in, if any
+		 */
 		void parse(
 			Parser& parser,
 			std::shared_ptr<langgen::ast::Scope> program,
-			std::vector<langgen::lexer::Token>& tokens
+			std::vector<langgen::lexer::Token>& tokens,
+			langgen::stats::Stats* stats = nullptr
+		);
+
+		void parse(
+			Parser& parser,
+			std::shared_ptr<langgen::ast::Scope> program,
+			TokenStream& tokens,
+			langgen::stats::Stats* stats = nullptr
+		);
+
+		/**
+		 * Parse the top-level statements of a program touched by an edit of its tokens again, keeping the other ones
+		 * @param program The program, parsed from `tokens` by `parse` before the edit
+		 * @param tokens The tokens after the edit
+		 * @param edit The edit of the tokens, as returned by `relex`
+		 * @return The edit of the statements of the program body, the statements outside of it are kept as they are
+		 * @note Parsing starts again from the statement before the edit, and stops at the first new statement ending where an old statement started after the edit
+		 * @note Nodes with the legacy signature erase the tokens they consume, and can not be reparsed
+		 * @note The new statements are never allocated in the arena of the program, so that its memory does not grow with every edit
+		 */
+		langgen::lexer::Edit reparse(
+			Parser& parser,
+			std::shared_ptr<langgen::ast::Scope> program,
+			std::vector<langgen::lexer::Token>& tokens,
+			const langgen::lexer::Edit& edit
+		);
+
+		/**
+		 * Parse a program from a token source, lexing it as the parser consumes it
+		 * @note Only the tokens of the statement being parsed are kept in memory
+		 * @note Nodes made from a ParseNodeFunction take a list of tokens, which cannot be refilled :
+		 * the first one tried lexes the rest of the source at once, use ParseStreamNodeFunctions to keep streaming
+		 * @note The stats record the tokens lexed while parsing, the lexing time is part of the parsing time
+		 */
+		void parse(
+			Parser& parser,
+			std::shared_ptr<langgen::ast::Scope> program,
+			langgen::lexer::TokenSource& source,
+			langgen::stats::Stats* stats = nullptr
 		);
 	}
 }
@@ -0,0 +1,97 @@
+#ifndef __LANGGEN_RESOLVER__
+#define __LANGGEN_RESOLVER__
+
+#include <AquIce/langgen/ast.hpp>
+#include <AquIce/langgen/env.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <functional>
+
+namespace langgen {
+	namespace resolver {
+
+		struct Resolver;
+
+		/**
+		 * Resolve the keys used by a node, and recursively by its children
+		 */
+		typedef std::function<void (
+			langgen::resolver::Resolver&,
+			std::shared_ptr<langgen::ast::Statement>
+		)> ResolveStatementFunction;
+
+		/**
+		 * A pass annotating the nodes of a program with the environment slots of the keys they use
+		 * @note The resolution assumes declarations are evaluated in the order they appear in their scope
+		 */
+		typedef struct Resolver {
+			std::unordered_map<std::string, ResolveStatementFunction> nodeResolutionFunctions;
+			/**
+			 * The slot of every key declared in the open scopes, from the outermost to the innermost
+			 */
+			std::vector<std::unordered_map<std::string, size_t>> scopes;
+			/**
+			 * The slot of the next key declared in each open scope, from the outermost to the innermost
+			 */
+			std::vector<size_t> nextSlots;
+		} Resolver;
+
+		void setup_resolver(
+			Resolver& resolver,
+			std::unordered_map<std::string, ResolveStatementFunction> nodeResolutionFunctions
+		);
+
+		/**
+		 * Declare a key in the innermost scope
+		 * @param resolver The resolver
+		 * @param key The key to declare
+		 * @return The slot of the key, or nothing if the key is already declared in this scope
+		 */
+		std::optional<size_t> declare(
+			Resolver& resolver,
+			const std::string& key
+		);
+
+		/**
+		 * Look a key up in the open scopes, from the innermost to the outermost
+		 * @param resolver The resolver
+		 * @param key The key to look up
+		 * @return The address of the key, or nothing if the key is not declared yet
+		 */
+		std::optional<langgen::env::SlotAddress> lookup(
+			Resolver& resolver,
+			const std::string& key
+		);
+
+		/**
+		 * Resolve a statement
+		 * @note Statements without a resolution function are left untouched
+		 */
+		void resolve_statement(
+			Resolver& resolver,
+			std::shared_ptr<langgen::ast::Statement> statement
+		);
+
+		void resolve_scope(
+			Resolver& resolver,
+			std::shared_ptr<langgen::ast::Scope> scope
+		);
+
+		/**
+		 * Resolve a program
+		 * @param env The environment the program is evaluated in, if it already holds values (for example builtins initialized by key) :
+		 * its keys are resolved to their slots, and the declarations of the program get the slots after them
+		 */
+		void resolve(
+			Resolver& resolver,
+			std::shared_ptr<langgen::ast::Scope> program,
+			std::shared_ptr<langgen::env::Environment> env = nullptr
+		);
+	}
+}
+
+#endif // __LANGGEN_RESOLVER__
@@ -0,0 +1,47 @@
+#ifndef __LANGGEN_SOURCE__
+#define __LANGGEN_SOURCE__
+
+#include <string>
+#include <string_view>
+#include <stdexcept>
+
+namespace langgen {
+	namespace lexer {
+
+		/**
+		 * A file mapped read-only in memory, to be lexed without being read nor copied
+		 * @note The views of the source (and the offsets of the tokens lexed from it) are valid as long as it lives
+		 */
+		class MappedSource {
+		public:
+			/**
+			 * Map a file
+			 * @throws std::runtime_error if the file can not be opened or mapped
+			 */
+			MappedSource(const std::string& path);
+			~MappedSource();
+
+			MappedSource(const MappedSource&) = delete;
+			MappedSource& operator=(const MappedSource&) = delete;
+
+			/**
+			 * Get the content of the file
+			 */
+			std::string_view view() const;
+
+			size_t size() const;
+
+		private:
+			const char* data;
+			size_t length;
+#ifdef _WIN32
+			void* file;
+			void* mapping;
+#else
+			int file;
+#endif
+		};
+	}
+}
+
+#endif // __LANGGEN_SOURCE__
@@ -0,0 +1,141 @@
+#ifndef __LANGGEN_STATS__
+#define __LANGGEN_STATS__
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * Run a statement with the stats being collected on the current thread, if any
+ * @note Compiles to nothing unless `LANGGEN_STATS` is defined when building the library
+ */
+#ifdef LANGGEN_STATS
+#define LANGGEN_STATS_RECORD(stats, ...) if(langgen::stats::Stats* stats = langgen::stats::active()) { __VA_ARGS__; }
+#else
+#define LANGGEN_STATS_RECORD(stats, ...)
+#endif
+
+namespace langgen {
+	namespace stats {
+
+		/**
+		 * Get whether the library collects stats (built with `LANGGEN_STATS`)
+		 * @note Compiled in the library, it does not depend on the flags of the includer
+		 */
+		bool enabled();
+
+		enum class Phase {
+			LEX,
+			PARSE,
+			INTERPRET
+		};
+
+		typedef struct NodeCounters {
+			/**
+			 * The number of times the node was tried
+			 */
+			size_t attempts = 0;
+			/**
+			 * The number of times the node did not match
+			 */
+			size_t failures = 0;
+		} NodeCounters;
+
+		/**
+		 * The counters of the lexer, parser and interpreter
+		 * @note Filled by `lex`, `parse` and `interpret` when given, and only if the library is built with `LANGGEN_STATS`
+		 */
+		typedef struct Stats {
+			/**
+			 * The wall time spent in each phase, in seconds, indexed by Phase
+			 */
+			std::array<double, 3> seconds = { 0, 0, 0 };
+			/**
+			 * The number of tokens produced, indexed by TokenKind
+			 */
+			std::vector<size_t> tokens;
+			/**
+			 * The attempts and failures of the registered nodes, by key in `nodesRegister`
+			 */
+			std::unordered_map<std::string, NodeCounters> nodes;
+			/**
+			 * The number of statements evaluated, indexed by NodeKind
+			 */
+			std::vector<size_t> evaluations;
+			/**
+			 * The number of environment lookups, indexed by the number of parents walked up to find the value
+			 */
+			std::vector<size_t> lookups;
+			/**
+			 * The number of validation rules called, indexed by ValidationRuleSensitivity
+			 */
+			std::array<size_t, 3> validations = { 0, 0, 0 };
+		} Stats;
+
+		/**
+		 * Get the stats being collected on the current thread
+		 * @return The stats, nullptr if none are
+		 */
+		inline Stats*& active() {
+			static thread_local Stats* stats = nullptr;
+			return stats;
+		}
+
+		/**
+		 * Increment a counter of a list, growing the list if needed
+		 */
+		inline void count(std::vector<size_t>& counters, size_t index) {
+			if(index >= counters.size()) {
+				counters.resize(index + 1, 0);
+			}
+			counters[index]++;
+		}
+
+		/**
+		 * Record the attempt of a registered node
+		 * @param matched Whether the node matched
+		 */
+		inline void count_node(Stats& stats, const std::string& key, bool matched) {
+			NodeCounters& counters = stats.nodes[key];
+			counters.attempts++;
+			if(!matched) {
+				counters.failures++;
+			}
+		}
+
+		/**
+		 * Collect stats during a phase : the stats are active on the current thread and the phase is timed until destruction
+		 * @note Does nothing if the stats are nullptr, nested phases given other stats collect in their own stats
+		 * @note Compiled in the library, its layout and behaviour do not depend on the flags of the includer
+		 */
+		class PhaseRecorder {
+		public:
+			PhaseRecorder(Stats* stats, Phase phase);
+			~PhaseRecorder();
+
+			PhaseRecorder(const PhaseRecorder&) = delete;
+			PhaseRecorder& operator=(const PhaseRecorder&) = delete;
+
+		private:
+			Stats* stats;
+			Stats* previous = nullptr;
+			Phase phase;
+			std::chrono::steady_clock::time_point start;
+		};
+
+		/**
+		 * Get a human readable dump of stats
+		 */
+		std::string repr(const Stats& stats);
+
+		/**
+		 * Get a JSON dump of stats, with the names of the token types, nodes and sensitivities as keys
+		 * @note The keys are sorted, dumps can be diffed
+		 */
+		std::string json(const Stats& stats);
+	}
+}
+
+#endif // __LANGGEN_STATS__
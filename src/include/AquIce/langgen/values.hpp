@@ -3,6 +3,7 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 
 namespace langgen {
 	namespace values {
@@ -72,6 +73,95 @@ namespace langgen {
 			double value;
 		};
 
+		/**
+		 * BooleanValue < RuntimeValue
+		 */
+		class BooleanValue: public RuntimeValue {
+		public:
+			/**
+			 * Create a new Boolean Value
+			 */
+			BooleanValue(bool value = false);
+			
+			bool get();
+
+			virtual std::string type() override;
+			
+			virtual std::string repr() override;
+			
+			virtual bool IsTrue() override;
+
+		private:
+			bool value;
+		};
+
+		/**
+		 * A compact value, storing numbers, booleans and null inline
+		 * @note Only the other runtime values are heap-allocated, copying an inline value does no reference counting
+		 */
+		class Value {
+		public:
+			enum class Tag : uint8_t {
+				NULL_VALUE,
+				NUMBER,
+				BOOLEAN,
+				OBJECT
+			};
+
+			/**
+			 * Create a new null Value
+			 */
+			Value();
+
+			static Value null();
+			static Value number(double number);
+			static Value boolean(bool boolean);
+			static Value object(std::shared_ptr<RuntimeValue> object);
+
+			/**
+			 * Convert a runtime value, unboxing null, number and boolean values
+			 */
+			static Value unbox(const std::shared_ptr<RuntimeValue>& value);
+
+			/**
+			 * Convert the value to a runtime value, allocating it if it is stored inline
+			 */
+			std::shared_ptr<RuntimeValue> box() const;
+
+			Tag tag() const;
+			bool is_null() const;
+			bool is_number() const;
+			bool is_boolean() const;
+			bool is_object() const;
+
+			double get_number() const;
+			bool get_boolean() const;
+			const std::shared_ptr<RuntimeValue>& get_object() const;
+
+			/**
+			 * Get the type of the value, the same as the one of the equivalent runtime value
+			 */
+			std::string type() const;
+
+			/**
+			 * Get the string representation of the value, the same as the one of the equivalent runtime value
+			 */
+			std::string repr() const;
+
+			/**
+			 * Checks whether the value is true or false
+			 */
+			bool IsTrue() const;
+
+		private:
+			Tag valueTag;
+			union {
+				double numberValue;
+				bool booleanValue;
+			};
+			std::shared_ptr<RuntimeValue> objectValue;
+		};
+
 		#pragma endregion
 	}
 }
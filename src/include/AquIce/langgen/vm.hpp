@@ -0,0 +1,225 @@
+#ifndef __LANGGEN_VM__
+#define __LANGGEN_VM__
+
+#include <AquIce/langgen/ast.hpp>
+#include <AquIce/langgen/values.hpp>
+#include <AquIce/langgen/env.hpp>
+#include <AquIce/langgen/interpreter.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <functional>
+
+namespace langgen {
+	namespace vm {
+
+		typedef uint32_t Opcode;
+
+		/**
+		 * The built-in opcodes, custom opcodes are numbered from `OP_CUSTOM`
+		 * @note Operands are named a, b and c, a always being the destination register
+		 */
+		enum : Opcode {
+			/**
+			 * a = constants[b]
+			 */
+			OP_LOAD_CONSTANT,
+			/**
+			 * a = b
+			 */
+			OP_MOVE,
+			/**
+			 * a = get(names[b])
+			 */
+			OP_GET,
+			/**
+			 * a = get_at(addresses[b])
+			 */
+			OP_GET_AT,
+			/**
+			 * a = set(names[b], c)
+			 */
+			OP_SET,
+			/**
+			 * a = set_at(addresses[b], c)
+			 */
+			OP_SET_AT,
+			/**
+			 * a = init(declarations[b], c)
+			 */
+			OP_INIT,
+			/**
+			 * a = evaluate_value(statements[b]), for nodes without a compilation function
+			 */
+			OP_EVALUATE,
+			/**
+			 * Record a as the result of statements[b]
+			 */
+			OP_RESULT,
+			OP_CUSTOM
+		};
+
+		typedef struct Instruction {
+			Opcode opcode;
+			uint32_t a;
+			uint32_t b;
+			uint32_t c;
+		} Instruction;
+
+		/**
+		 * A declaration made by an `OP_INIT` instruction
+		 */
+		typedef struct Declaration {
+			std::string key;
+			/**
+			 * The slot reserved by a resolver, if any
+			 */
+			std::optional<size_t> slot;
+			langgen::env::Properties properties;
+		} Declaration;
+
+		/**
+		 * A compiled program
+		 */
+		typedef struct Program {
+			std::vector<Instruction> code;
+			std::vector<langgen::values::Value> constants;
+			std::vector<std::string> names;
+			std::vector<langgen::env::SlotAddress> addresses;
+			std::vector<Declaration> declarations;
+			std::vector<std::shared_ptr<langgen::ast::Statement>> statements;
+			/**
+			 * The number of registers used by the program
+			 */
+			size_t registerCount = 0;
+		} Program;
+
+		/**
+		 * The state of a running program, given to custom opcodes
+		 */
+		typedef struct Frame {
+			langgen::interpreter::Interpreter* interpreter;
+			const Program* program;
+			std::shared_ptr<langgen::env::Environment> env;
+			std::vector<langgen::values::Value> registers;
+		} Frame;
+
+		struct VM;
+		struct Compiler;
+
+		/**
+		 * Run a custom instruction
+		 */
+		typedef std::function<void (
+			langgen::vm::Frame&,
+			const langgen::vm::Instruction&
+		)> OpcodeFunction;
+
+		/**
+		 * Compile a node, and recursively its children
+		 * @return The register holding the value of the node
+		 */
+		typedef std::function<uint32_t (
+			langgen::vm::Compiler&,
+			const std::shared_ptr<langgen::ast::Statement>&
+		)> CompileStatementFunction;
+
+		/**
+		 * An execution engine running programs compiled to bytecode
+		 */
+		typedef struct VM {
+			std::unordered_map<std::string, CompileStatementFunction> nodeCompilationFunctions;
+			/**
+			 * The opcode of every custom instruction, by name
+			 */
+			std::unordered_map<std::string, Opcode> opcodes;
+			/**
+			 * The custom instructions, indexed by opcode minus `OP_CUSTOM`
+			 */
+			std::vector<OpcodeFunction> opcodeFunctions;
+		} VM;
+
+		/**
+		 * The state of a compilation, given to compilation functions
+		 */
+		typedef struct Compiler {
+			langgen::vm::VM* vm;
+			langgen::interpreter::Interpreter* interpreter;
+			Program program;
+			/**
+			 * The first free register, registers are released after each top-level statement
+			 */
+			uint32_t registerTop = 0;
+		} Compiler;
+
+		void setup_vm(
+			VM& vm,
+			std::unordered_map<std::string, CompileStatementFunction> nodeCompilationFunctions,
+			std::unordered_map<std::string, OpcodeFunction> customOpcodes = std::unordered_map<std::string, OpcodeFunction>()
+		);
+
+		/**
+		 * Get the opcode of a custom instruction
+		 */
+		Opcode get_opcode(
+			VM& vm,
+			const std::string& name
+		);
+
+		uint32_t allocate_register(Compiler& compiler);
+
+		void emit(
+			Compiler& compiler,
+			Opcode opcode,
+			uint32_t a = 0,
+			uint32_t b = 0,
+			uint32_t c = 0
+		);
+
+		uint32_t add_constant(Compiler& compiler, const langgen::values::Value& value);
+		uint32_t add_name(Compiler& compiler, const std::string& name);
+		uint32_t add_address(Compiler& compiler, langgen::env::SlotAddress address);
+		uint32_t add_declaration(Compiler& compiler, Declaration declaration);
+		uint32_t add_statement(Compiler& compiler, const std::shared_ptr<langgen::ast::Statement>& statement);
+
+		/**
+		 * Compile a statement
+		 * @return The register holding the value of the statement
+		 * @note Statements without a compilation function are evaluated by the interpreter at runtime
+		 */
+		uint32_t compile_statement(
+			Compiler& compiler,
+			const std::shared_ptr<langgen::ast::Statement>& statement
+		);
+
+		/**
+		 * Compile a program, once, to be run as many times as needed
+		 * @param interpreter The interpreter providing the environment schema, and evaluating the nodes which can not be compiled
+		 */
+		Program compile(
+			VM& vm,
+			langgen::interpreter::Interpreter& interpreter,
+			std::shared_ptr<langgen::ast::Scope> program
+		);
+
+		/**
+		 * Run a compiled program
+		 * @param sink The sink to record the results of the top-level statements in
+		 * @param env The environment to run the program in, a new one is created if none is given
+		 * @return The result of the last statement, null if the program is empty
+		 */
+		langgen::values::Value run(
+			VM& vm,
+			langgen::interpreter::Interpreter& interpreter,
+			const Program& program,
+			langgen::interpreter::ResultSink& sink,
+			std::shared_ptr<langgen::env::Environment> env = nullptr
+		);
+	}
+}
+
+#endif // __LANGGEN_VM__
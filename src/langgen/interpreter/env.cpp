@@ -1,88 +1,347 @@
 #include <AquIce/langgen/env.hpp>
 
+#pragma region Properties
+
+langgen::env::Properties::Properties(std::shared_ptr<const langgen::env::EnvSchema> schema) {
+	this->schema = schema;
+	if(schema != nullptr) {
+		this->values.resize(schema->property_count());
+	}
+}
+
+const std::string& langgen::env::Properties::at(const std::string& name) const {
+	std::optional<size_t> id = this->schema == nullptr ? std::nullopt : this->schema->property_id(name);
+	if(!id.has_value()) {
+		throw std::out_of_range("Undeclared property " + name);
+	}
+	return this->at(id.value());
+}
+
+const std::string& langgen::env::Properties::at(size_t id) const {
+	if(id >= this->values.size() || !this->values[id].has_value()) {
+		throw std::out_of_range("Unset property " + std::to_string(id));
+	}
+	return this->values[id].value();
+}
+
+void langgen::env::Properties::set(const std::string& name, std::string value) {
+	std::optional<size_t> id = this->schema == nullptr ? std::nullopt : this->schema->property_id(name);
+	if(!id.has_value()) {
+		throw std::runtime_error("Invalid variable property " + name);
+	}
+	this->set(id.value(), value);
+}
+
+void langgen::env::Properties::set(size_t id, std::string value) {
+	if(id >= this->values.size()) {
+		this->values.resize(id + 1);
+	}
+	this->values[id] = value;
+}
+
+#pragma endregion
+
+#pragma region EnvSchema
+
+langgen::env::EnvSchema::EnvSchema(
+	std::vector<std::string> envValuesProperties,
+	std::vector<EnvValidationRule> validationRules
+) {
+	for(const std::string& property : envValuesProperties) {
+		this->propertyIds.emplace(property, this->propertyIds.size());
+	}
+
+	for(const langgen::env::EnvValidationRule& rule : validationRules) {
+		if(std::find(rule.sensitivity.begin(), rule.sensitivity.end(), langgen::env::ValidationRuleSensitivity::INIT) != rule.sensitivity.end()) {
+			this->initValidationFunctions.push_back(rule.validationFunction);
+		}
+		if(std::find(rule.sensitivity.begin(), rule.sensitivity.end(), langgen::env::ValidationRuleSensitivity::SET) != rule.sensitivity.end()) {
+			this->setValidationFunctions.push_back(rule.validationFunction);
+		}
+		if(std::find(rule.sensitivity.begin(), rule.sensitivity.end(), langgen::env::ValidationRuleSensitivity::GET) != rule.sensitivity.end()) {
+			this->getValidationFunctions.push_back(rule.validationFunction);
+		}
+	}
+}
+
+std::optional<size_t> langgen::env::EnvSchema::property_id(const std::string& name) const {
+	auto id = this->propertyIds.find(name);
+	if(id == this->propertyIds.end()) {
+		return std::nullopt;
+	}
+	return id->second;
+}
+
+size_t langgen::env::EnvSchema::property_count() const {
+	return this->propertyIds.size();
+}
+
+langgen::env::Properties langgen::env::EnvSchema::make_properties(const std::unordered_map<std::string, std::string>& properties) const {
+	langgen::env::Properties compiled(this->shared_from_this());
+	for(const auto& [prop_key, prop_value] : properties) {
+		compiled.set(prop_key, prop_value);
+	}
+	return compiled;
+}
+
+const std::vector<langgen::env::EnvValidationFunction>& langgen::env::EnvSchema::get_init_validation_functions() const {
+	return this->initValidationFunctions;
+}
+const std::vector<langgen::env::EnvValidationFunction>& langgen::env::EnvSchema::get_set_validation_functions() const {
+	return this->setValidationFunctions;
+}
+const std::vector<langgen::env::EnvValidationFunction>& langgen::env::EnvSchema::get_get_validation_functions() const {
+	return this->getValidationFunctions;
+}
+
+#pragma endregion
+
+#pragma region Environment
+
 langgen::env::Environment::Environment(
 	std::vector<std::string> envValuesProperties,
 	std::vector<EnvValidationRule> validationRules,
 	std::shared_ptr<Environment> parent
 ) {
-	this->envValuesProperties = envValuesProperties;
-	this->validationRules = validationRules;
+	this->schema = std::make_shared<langgen::env::EnvSchema>(envValuesProperties, validationRules);
+	this->parent = parent;
+}
+
+langgen::env::Environment::Environment(
+	std::shared_ptr<const langgen::env::EnvSchema> schema,
+	std::shared_ptr<Environment> parent
+) {
+	this->schema = schema;
 	this->parent = parent;
-	this->values = std::unordered_map<std::string, EnvValue>();
 }
 
-bool langgen::env::Environment::has_value(std::string key) {
-	return this->values.find(key) != this->values.end();
+const std::shared_ptr<const langgen::env::EnvSchema>& langgen::env::Environment::get_schema() {
+	return this->schema;
 }
 
-std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::set_value(
-	std::string key,
-	std::shared_ptr<langgen::values::RuntimeValue> value
-) {
-	if(!this->has_value(key)) {
-		if(this->parent != nullptr) {
-			return this->parent->set_value(key, value);
+const std::vector<std::string>& langgen::env::Environment::get_keys() {
+	return this->keys;
+}
+
+bool langgen::env::Environment::has_value(const std::string& key) {
+	return this->slots.find(key) != this->slots.end();
+}
+
+langgen::env::Environment& langgen::env::Environment::resolve(langgen::env::SlotAddress address) {
+	langgen::env::Environment* env = this;
+	for(size_t depth = 0; depth < address.depth; depth++) {
+		if(env->parent == nullptr) {
+			throw std::runtime_error("Trying to resolve an address outside of the environment chain");
 		}
-		throw std::runtime_error("Trying to set non-declared variable " + key);
+		env = env->parent.get();
 	}
-	
-	std::shared_ptr<langgen::values::RuntimeValue> old_val = this->get_value(key);
+	LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->lookups, address.depth));
+	return *env;
+}
 
-	for(const langgen::env::EnvValidationRule& rule : this->validationRules) {
-		if(std::find(rule.sensitivity.begin(), rule.sensitivity.end(), langgen::env::ValidationRuleSensitivity::SET) != rule.sensitivity.end()) {
-			if(!rule.validationFunction(this->values.at(key))) {
-				throw std::runtime_error("Validation rule triggered on " + key);
-			}
+langgen::env::Environment* langgen::env::Environment::find(const std::string& key, size_t& slot) {
+	[[maybe_unused]] size_t hops = 0;
+	for(langgen::env::Environment* env = this; env != nullptr; env = env->parent.get()) {
+		auto found = env->slots.find(key);
+		if(found != env->slots.end()) {
+			LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->lookups, hops));
+			slot = found->second;
+			return env;
 		}
+		hops++;
 	}
+	return nullptr;
+}
 
-	this->values.at(key).value = value;
+std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::set_value(
+	const std::string& key,
+	std::shared_ptr<langgen::values::RuntimeValue> value
+) {
+	return this->set(key, langgen::values::Value::unbox(value)).box();
+}
 
-	return old_val;
+std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::set_value_at(
+	langgen::env::SlotAddress address,
+	std::shared_ptr<langgen::values::RuntimeValue> value
+) {
+	return this->set_at(address, langgen::values::Value::unbox(value)).box();
 }
 
 std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::init_value(
-	std::string key,
+	const std::string& key,
+	std::shared_ptr<langgen::values::RuntimeValue> value,
+	std::unordered_map<std::string, std::string> properties
+) {
+	this->init(key, langgen::values::Value::unbox(value), properties);
+	return value;
+}
+
+std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::init_value_at(
+	size_t slot,
+	const std::string& key,
 	std::shared_ptr<langgen::values::RuntimeValue> value,
 	std::unordered_map<std::string, std::string> properties
 ) {
+	this->init_at(slot, key, langgen::values::Value::unbox(value), properties);
+	return value;
+}
 
-	for(const auto& [prop_key, prop_value] : properties) {
-		if(std::find(this->envValuesProperties.begin(), this->envValuesProperties.end(), prop_key) == this->envValuesProperties.end()) {
-			throw std::runtime_error("Invalid variable property " + prop_key);
+std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::get_value(const std::string& key) {
+	return this->get(key).box();
+}
+
+std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::get_value_at(langgen::env::SlotAddress address) {
+	return this->get_at(address).box();
+}
+
+langgen::values::Value langgen::env::Environment::set(
+	const std::string& key,
+	const langgen::values::Value& value
+) {
+	size_t slot;
+	langgen::env::Environment* env = this->find(key, slot);
+	if(env == nullptr) {
+		throw std::runtime_error("Trying to set non-declared variable " + key);
+	}
+	return env->set_slot(slot, value);
+}
+
+langgen::values::Value langgen::env::Environment::set_at(
+	langgen::env::SlotAddress address,
+	const langgen::values::Value& value
+) {
+	return this->resolve(address).set_slot(address.slot, value);
+}
+
+langgen::values::Value langgen::env::Environment::set_slot(
+	size_t slot,
+	const langgen::values::Value& value
+) {
+	langgen::values::Value old_val = this->get_slot(slot);
+
+	for(const langgen::env::EnvValidationFunction& validationFunction : this->schema->get_set_validation_functions()) {
+		LANGGEN_STATS_RECORD(stats, stats->validations[static_cast<size_t>(langgen::env::ValidationRuleSensitivity::SET)]++);
+		if(!validationFunction(this->values[slot])) {
+			throw std::runtime_error("Validation rule triggered on " + this->keys[slot]);
 		}
 	}
 
+	this->values[slot].value = value;
+
+	return old_val;
+}
+
+langgen::values::Value langgen::env::Environment::init(
+	const std::string& key,
+	const langgen::values::Value& value,
+	std::unordered_map<std::string, std::string> properties
+) {
+	return this->init(key, value, this->schema->make_properties(properties));
+}
+
+langgen::values::Value langgen::env::Environment::init_at(
+	size_t slot,
+	const std::string& key,
+	const langgen::values::Value& value,
+	std::unordered_map<std::string, std::string> properties
+) {
+	return this->init_slot(slot, key, value, this->schema->make_properties(properties));
+}
+
+langgen::values::Value langgen::env::Environment::init(
+	const std::string& key,
+	const langgen::values::Value& value,
+	langgen::env::Properties properties
+) {
+	size_t slot = this->values.size();
+	langgen::values::Value result = this->init_slot(slot, key, value, properties);
+	this->keyedSlots[slot] = true;
+	return result;
+}
+
+langgen::values::Value langgen::env::Environment::init_at(
+	size_t slot,
+	const std::string& key,
+	const langgen::values::Value& value,
+	langgen::env::Properties properties
+) {
+	return this->init_slot(slot, key, value, properties);
+}
+
+langgen::values::Value langgen::env::Environment::init_slot(
+	size_t slot,
+	const std::string& key,
+	const langgen::values::Value& value,
+	langgen::env::Properties properties
+) {
 	if(this->has_value(key)) {
 		throw std::runtime_error("Trying to redeclare an existing variable " + key);
 	}
 
-	for(const langgen::env::EnvValidationRule& rule : this->validationRules) {
-		if(std::find(rule.sensitivity.begin(), rule.sensitivity.end(), langgen::env::ValidationRuleSensitivity::INIT) != rule.sensitivity.end()) {
-			if(rule.validationFunction(this->values.at(key))) {
-				throw std::runtime_error("Validation rule triggered on " + key);
-			}
+	if(slot < this->keys.size() && this->keys[slot].length() != 0) {
+		if(!this->keyedSlots[slot]) {
+			throw std::runtime_error("Trying to declare " + key + " in the slot of " + this->keys[slot]);
+		}
+		// Values declared by key are never addressed by slot, move it after the slots of the resolved declarations
+		size_t end = this->values.size();
+		langgen::env::EnvValue moved = this->values[slot];
+		this->values.push_back(moved);
+		this->keys.push_back(this->keys[slot]);
+		this->keyedSlots.push_back(true);
+		this->slots[this->keys[end]] = end;
+		this->keys[slot].clear();
+		this->keyedSlots[slot] = false;
+	}
+
+	langgen::env::EnvValue envValue = langgen::env::EnvValue{value, std::move(properties)};
+
+	for(const langgen::env::EnvValidationFunction& validationFunction : this->schema->get_init_validation_functions()) {
+		LANGGEN_STATS_RECORD(stats, stats->validations[static_cast<size_t>(langgen::env::ValidationRuleSensitivity::INIT)]++);
+		if(validationFunction(envValue)) {
+			throw std::runtime_error("Validation rule triggered on " + key);
 		}
 	}
 
-	this->values[key] = langgen::env::EnvValue(langgen::env::EnvValue{value, properties});
+	if(slot >= this->values.size()) {
+		this->values.resize(slot + 1);
+		this->keys.resize(slot + 1);
+		this->keyedSlots.resize(slot + 1);
+	}
+	this->values[slot] = envValue;
+	this->keys[slot] = key;
+	this->slots[key] = slot;
 
 	return value;
 }
 
-std::shared_ptr<langgen::values::RuntimeValue> langgen::env::Environment::get_value(std::string key) {
-	if(!this->has_value(key)) {
-		if(this->parent != nullptr) {
-			return this->parent->get_value(key);
-		}
+langgen::values::Value langgen::env::Environment::get(const std::string& key) {
+	size_t slot;
+	langgen::env::Environment* env = this->find(key, slot);
+	if(env == nullptr) {
 		throw std::runtime_error("Trying to get non-declared variable " + key);
 	}
-	for(const langgen::env::EnvValidationRule& rule : this->validationRules) {
-		if(std::find(rule.sensitivity.begin(), rule.sensitivity.end(), langgen::env::ValidationRuleSensitivity::GET) != rule.sensitivity.end()) {
-			if(rule.validationFunction(this->values.at(key))) {
-				throw std::runtime_error("Validation rule triggered on " + key);
-			}
+	return env->get_slot(slot);
+}
+
+langgen::values::Value langgen::env::Environment::get_at(langgen::env::SlotAddress address) {
+	return this->resolve(address).get_slot(address.slot);
+}
+
+const langgen::values::Value& langgen::env::Environment::get_slot(size_t slot) {
+	if(slot >= this->keys.size() || this->keys[slot].length() == 0) {
+		throw std::runtime_error("Trying to get non-declared variable in slot " + std::to_string(slot));
+	}
+	const std::vector<langgen::env::EnvValidationFunction>& getValidationFunctions = this->schema->get_get_validation_functions();
+	if(getValidationFunctions.empty()) {
+		return this->values[slot].value;
+	}
+	for(const langgen::env::EnvValidationFunction& validationFunction : getValidationFunctions) {
+		LANGGEN_STATS_RECORD(stats, stats->validations[static_cast<size_t>(langgen::env::ValidationRuleSensitivity::GET)]++);
+		if(validationFunction(this->values[slot])) {
+			throw std::runtime_error("Validation rule triggered on " + this->keys[slot]);
 		}
 	}
-	return this->values.at(key).value;
-}
\ No newline at end of file
+	return this->values[slot].value;
+}
+
+#pragma endregion
\ No newline at end of file
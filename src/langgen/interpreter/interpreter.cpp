@@ -1,15 +1,95 @@
 #include <AquIce/langgen/interpreter.hpp>
 
+void langgen::interpreter::compile_evaluation_functions(langgen::interpreter::Interpreter& interpreter) {
+	interpreter.evaluationTable.clear();
+	interpreter.valueEvaluationTable.clear();
+
+	for(const auto& [nodeType, evaluateFn] : interpreter.nodeEvaluationFunctions) {
+		langgen::ast::NodeKind kind = langgen::ast::node_kind(nodeType);
+		if(kind >= interpreter.evaluationTable.size()) {
+			interpreter.evaluationTable.resize(kind + 1);
+		}
+		interpreter.evaluationTable[kind] = evaluateFn;
+	}
+
+	for(const auto& [nodeType, evaluateFn] : interpreter.nodeValueEvaluationFunctions) {
+		langgen::ast::NodeKind kind = langgen::ast::node_kind(nodeType);
+		if(kind >= interpreter.valueEvaluationTable.size()) {
+			interpreter.valueEvaluationTable.resize(kind + 1);
+		}
+		interpreter.valueEvaluationTable[kind] = evaluateFn;
+	}
+}
+
+/**
+ * Look up the evaluation functions of a statement registered after the last compilation
+ * @note Only reads the maps, the compiled tables are left untouched so concurrent evaluations do not race
+ */
+static void find_evaluation_functions(
+	const langgen::interpreter::Interpreter& interpreter,
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const langgen::interpreter::ParseStatementFunction*& evaluateFn,
+	const langgen::interpreter::EvaluateValueFunction*& evaluateValueFn
+) {
+	auto foundFn = interpreter.nodeEvaluationFunctions.find(statement->type());
+	evaluateFn = foundFn != interpreter.nodeEvaluationFunctions.end() ? &foundFn->second : nullptr;
+
+	auto foundValueFn = interpreter.nodeValueEvaluationFunctions.find(statement->type());
+	evaluateValueFn = foundValueFn != interpreter.nodeValueEvaluationFunctions.end() ? &foundValueFn->second : nullptr;
+
+	if(evaluateFn == nullptr && evaluateValueFn == nullptr) {
+		throw std::runtime_error("Trying to evaluate unknown statement " + statement->type());
+	}
+}
+
+void langgen::interpreter::compile_env_schema(langgen::interpreter::Interpreter& interpreter) {
+	interpreter.envSchema = std::make_shared<langgen::env::EnvSchema>(
+		interpreter.envValuesProperties,
+		interpreter.validationRules
+	);
+}
+
+const std::shared_ptr<const langgen::env::EnvSchema>& langgen::interpreter::get_env_schema(langgen::interpreter::Interpreter& interpreter) {
+	if(interpreter.envSchema == nullptr) {
+		langgen::interpreter::compile_env_schema(interpreter);
+	}
+	return interpreter.envSchema;
+}
+
+void langgen::interpreter::record_result(
+	langgen::interpreter::ResultSink& sink,
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const langgen::values::Value& value
+) {
+	switch(sink.policy) {
+		case langgen::interpreter::ResultPolicy::ORDERED:
+			sink.results.push_back(langgen::interpreter::StatementResult{statement, value});
+			break;
+		case langgen::interpreter::ResultPolicy::LAST:
+			if(sink.results.empty()) {
+				sink.results.push_back(langgen::interpreter::StatementResult{statement, value});
+			} else {
+				sink.results.back() = langgen::interpreter::StatementResult{statement, value};
+			}
+			break;
+		default:
+			break;
+	}
+}
+
 void langgen::interpreter::setup_interpreter(
 	langgen::interpreter::Interpreter& interpreter,
 	std::unordered_map<std::string, ParseStatementFunction> nodeEvaluationFunctions,
 	std::vector<std::string> envValuesProperties,
-	std::vector<langgen::env::EnvValidationRule> validationRules
+	std::vector<langgen::env::EnvValidationRule> validationRules,
+	std::unordered_map<std::string, EvaluateValueFunction> nodeValueEvaluationFunctions
 ) {
 	interpreter.envValuesProperties = envValuesProperties;
 
 	interpreter.validationRules = validationRules;
 
+	langgen::interpreter::compile_env_schema(interpreter);
+
 	interpreter.nodeEvaluationFunctions = nodeEvaluationFunctions;
 	interpreter.nodeEvaluationFunctions["NumberExpression"] = [] (
 		langgen::interpreter::Interpreter& interpreter,
@@ -20,6 +100,19 @@ void langgen::interpreter::setup_interpreter(
 			std::dynamic_pointer_cast<langgen::ast::NumberExpression>(statement)->value
 		);
 	};
+
+	interpreter.nodeValueEvaluationFunctions = nodeValueEvaluationFunctions;
+	interpreter.nodeValueEvaluationFunctions["NumberExpression"] = [] (
+		langgen::interpreter::Interpreter& interpreter,
+		const std::shared_ptr<langgen::ast::Statement>& statement,
+		const std::shared_ptr<langgen::env::Environment>& env
+	) -> langgen::values::Value {
+		return langgen::values::Value::number(
+			std::static_pointer_cast<langgen::ast::NumberExpression>(statement)->value
+		);
+	};
+
+	langgen::interpreter::compile_evaluation_functions(interpreter);
 }
 
 std::shared_ptr<langgen::values::RuntimeValue> langgen::interpreter::evaluate_statement(
@@ -27,12 +120,54 @@ std::shared_ptr<langgen::values::RuntimeValue> langgen::interpreter::evaluate_st
 	std::shared_ptr<langgen::ast::Statement> statement,
 	std::shared_ptr<langgen::env::Environment> env
 ) {
-	for(const auto& [nodeType, evaluateFn] : interpreter.nodeEvaluationFunctions) {
-		if(statement->type() == nodeType) {
-			return evaluateFn(interpreter, statement, env);
-		}
+	langgen::ast::NodeKind kind = statement->kind();
+
+	LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->evaluations, kind));
+
+	if(kind < interpreter.evaluationTable.size() && interpreter.evaluationTable[kind]) {
+		return interpreter.evaluationTable[kind](interpreter, statement, env);
+	}
+	if(kind < interpreter.valueEvaluationTable.size() && interpreter.valueEvaluationTable[kind]) {
+		return interpreter.valueEvaluationTable[kind](interpreter, statement, env).box();
+	}
+
+	// Not compiled, the function was registered after the last `compile_evaluation_functions`
+	const langgen::interpreter::ParseStatementFunction* evaluateFn;
+	const langgen::interpreter::EvaluateValueFunction* evaluateValueFn;
+	find_evaluation_functions(interpreter, statement, evaluateFn, evaluateValueFn);
+
+	if(evaluateFn != nullptr) {
+		return (*evaluateFn)(interpreter, statement, env);
+	}
+	return (*evaluateValueFn)(interpreter, statement, env).box();
+}
+
+langgen::values::Value langgen::interpreter::evaluate_value(
+	langgen::interpreter::Interpreter& interpreter,
+	const std::shared_ptr<langgen::ast::Statement>& statement,
+	const std::shared_ptr<langgen::env::Environment>& env
+) {
+	langgen::ast::NodeKind kind = statement->kind();
+
+	LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->evaluations, kind));
+
+	if(kind < interpreter.valueEvaluationTable.size() && interpreter.valueEvaluationTable[kind]) {
+		return interpreter.valueEvaluationTable[kind](interpreter, statement, env);
+	}
+
+	if(kind < interpreter.evaluationTable.size() && interpreter.evaluationTable[kind]) {
+		return langgen::values::Value::unbox(interpreter.evaluationTable[kind](interpreter, statement, env));
+	}
+
+	// Not compiled, the function was registered after the last `compile_evaluation_functions`
+	const langgen::interpreter::ParseStatementFunction* evaluateFn;
+	const langgen::interpreter::EvaluateValueFunction* evaluateValueFn;
+	find_evaluation_functions(interpreter, statement, evaluateFn, evaluateValueFn);
+
+	if(evaluateValueFn != nullptr) {
+		return (*evaluateValueFn)(interpreter, statement, env);
 	}
-	throw std::runtime_error("Trying to evaluate unknown statement " + statement->type());
+	return langgen::values::Value::unbox((*evaluateFn)(interpreter, statement, env));
 }
 
 std::shared_ptr<langgen::values::RuntimeValue> langgen::interpreter::evaluate_scope(
@@ -41,22 +176,45 @@ std::shared_ptr<langgen::values::RuntimeValue> langgen::interpreter::evaluate_sc
 	std::unordered_map<std::string, std::string>& results,
 	std::shared_ptr<langgen::env::Environment> scope_env,
 	std::shared_ptr<langgen::env::Environment> parent_env
+) {
+	if(scope->body.empty()) {
+		return nullptr;
+	}
+
+	langgen::interpreter::ResultSink sink = langgen::interpreter::ResultSink{langgen::interpreter::ResultPolicy::ORDERED};
+
+	langgen::values::Value result = langgen::interpreter::evaluate_scope(
+		interpreter,
+		scope,
+		sink,
+		scope_env,
+		parent_env
+	);
+
+	langgen::interpreter::render_results(sink, results);
+
+	return result.box();
+}
+
+langgen::values::Value langgen::interpreter::evaluate_scope(
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Scope> scope,
+	langgen::interpreter::ResultSink& sink,
+	std::shared_ptr<langgen::env::Environment> scope_env,
+	std::shared_ptr<langgen::env::Environment> parent_env
 ) {
 	if(scope_env == nullptr) {
 		scope_env = std::make_shared<langgen::env::Environment>(
-			interpreter.envValuesProperties,
-			interpreter.validationRules,
+			langgen::interpreter::get_env_schema(interpreter),
 			parent_env
 		);
 	}
 
-	std::shared_ptr<langgen::values::RuntimeValue> result;
-	std::shared_ptr<langgen::values::RuntimeValue> prev_result = std::make_shared<langgen::values::NullValue>();
+	langgen::values::Value result;
 
-	for(std::shared_ptr<langgen::ast::Statement> statement : scope->body) {
-		result = langgen::interpreter::evaluate_statement(interpreter, statement, scope_env);
-		prev_result = result;
-		results[statement->repr()] = result->repr();
+	for(const std::shared_ptr<langgen::ast::Statement>& statement : scope->body) {
+		result = langgen::interpreter::evaluate_value(interpreter, statement, scope_env);
+		langgen::interpreter::record_result(sink, statement, result);
 	}
 	return result;
 }
@@ -64,17 +222,46 @@ std::shared_ptr<langgen::values::RuntimeValue> langgen::interpreter::evaluate_sc
 void langgen::interpreter::interpret(
 	langgen::interpreter::Interpreter& interpreter,
 	std::unordered_map<std::string, std::string>& results,
-	std::shared_ptr<langgen::ast::Scope> program
+	std::shared_ptr<langgen::ast::Scope> program,
+	langgen::stats::Stats* stats
 ) {
+	langgen::interpreter::ResultSink sink = langgen::interpreter::ResultSink{langgen::interpreter::ResultPolicy::ORDERED};
+
+	langgen::interpreter::interpret(
+		interpreter,
+		sink,
+		program,
+		stats
+	);
+
+	langgen::interpreter::render_results(sink, results);
+}
+
+void langgen::interpreter::interpret(
+	langgen::interpreter::Interpreter& interpreter,
+	langgen::interpreter::ResultSink& sink,
+	std::shared_ptr<langgen::ast::Scope> program,
+	langgen::stats::Stats* stats
+) {
+	langgen::stats::PhaseRecorder recorder(stats, langgen::stats::Phase::INTERPRET);
+
 	std::shared_ptr<langgen::env::Environment> env = std::make_shared<langgen::env::Environment>(
-		interpreter.envValuesProperties,
-		interpreter.validationRules
+		langgen::interpreter::get_env_schema(interpreter)
 	);
 
 	langgen::interpreter::evaluate_scope(
 		interpreter,
 		program,
-		results,
+		sink,
 		env
 	);
+}
+
+void langgen::interpreter::render_results(
+	const langgen::interpreter::ResultSink& sink,
+	std::unordered_map<std::string, std::string>& results
+) {
+	for(const langgen::interpreter::StatementResult& result : sink.results) {
+		results[result.statement->repr()] = result.value.repr();
+	}
 }
\ No newline at end of file
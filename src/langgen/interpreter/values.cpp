@@ -45,4 +45,156 @@ bool langgen::values::NumberValue::IsTrue() {
 	return this->value != 0;
 }
 
+#pragma endregion
+
+#pragma region BooleanValue
+
+langgen::values::BooleanValue::BooleanValue(bool value) {
+	this->value = value;
+}
+bool langgen::values::BooleanValue::get() {
+	return this->value;
+}
+std::string langgen::values::BooleanValue::type() {
+	return "BooleanValue";
+}
+std::string langgen::values::BooleanValue::repr() {
+	return this->value ? "true" : "false";
+}
+bool langgen::values::BooleanValue::IsTrue() {
+	return this->value;
+}
+
+#pragma endregion
+
+#pragma region Value
+
+langgen::values::Value::Value() {
+	this->valueTag = Tag::NULL_VALUE;
+	this->numberValue = 0;
+}
+
+langgen::values::Value langgen::values::Value::null() {
+	return langgen::values::Value();
+}
+langgen::values::Value langgen::values::Value::number(double number) {
+	langgen::values::Value value;
+	value.valueTag = Tag::NUMBER;
+	value.numberValue = number;
+	return value;
+}
+langgen::values::Value langgen::values::Value::boolean(bool boolean) {
+	langgen::values::Value value;
+	value.valueTag = Tag::BOOLEAN;
+	value.booleanValue = boolean;
+	return value;
+}
+langgen::values::Value langgen::values::Value::object(std::shared_ptr<langgen::values::RuntimeValue> object) {
+	if(object == nullptr) {
+		throw std::runtime_error("Trying to store a null runtime value");
+	}
+	langgen::values::Value value;
+	value.valueTag = Tag::OBJECT;
+	value.objectValue = object;
+	return value;
+}
+
+langgen::values::Value langgen::values::Value::unbox(const std::shared_ptr<langgen::values::RuntimeValue>& value) {
+	if(langgen::values::NumberValue* number = dynamic_cast<langgen::values::NumberValue*>(value.get())) {
+		return langgen::values::Value::number(number->get());
+	}
+	if(langgen::values::BooleanValue* boolean = dynamic_cast<langgen::values::BooleanValue*>(value.get())) {
+		return langgen::values::Value::boolean(boolean->get());
+	}
+	if(dynamic_cast<langgen::values::NullValue*>(value.get()) != nullptr) {
+		return langgen::values::Value::null();
+	}
+	return langgen::values::Value::object(value);
+}
+
+std::shared_ptr<langgen::values::RuntimeValue> langgen::values::Value::box() const {
+	switch(this->valueTag) {
+		case Tag::NUMBER:
+			return std::make_shared<langgen::values::NumberValue>(this->numberValue);
+		case Tag::BOOLEAN:
+			return std::make_shared<langgen::values::BooleanValue>(this->booleanValue);
+		case Tag::OBJECT:
+			return this->objectValue;
+		default:
+			return std::make_shared<langgen::values::NullValue>();
+	}
+}
+
+langgen::values::Value::Tag langgen::values::Value::tag() const {
+	return this->valueTag;
+}
+bool langgen::values::Value::is_null() const {
+	return this->valueTag == Tag::NULL_VALUE;
+}
+bool langgen::values::Value::is_number() const {
+	return this->valueTag == Tag::NUMBER;
+}
+bool langgen::values::Value::is_boolean() const {
+	return this->valueTag == Tag::BOOLEAN;
+}
+bool langgen::values::Value::is_object() const {
+	return this->valueTag == Tag::OBJECT;
+}
+
+double langgen::values::Value::get_number() const {
+	if(this->valueTag != Tag::NUMBER) {
+		throw std::runtime_error("Trying to get a number from a " + this->type());
+	}
+	return this->numberValue;
+}
+bool langgen::values::Value::get_boolean() const {
+	if(this->valueTag != Tag::BOOLEAN) {
+		throw std::runtime_error("Trying to get a boolean from a " + this->type());
+	}
+	return this->booleanValue;
+}
+const std::shared_ptr<langgen::values::RuntimeValue>& langgen::values::Value::get_object() const {
+	if(this->valueTag != Tag::OBJECT) {
+		throw std::runtime_error("Trying to get an object from a " + this->type());
+	}
+	return this->objectValue;
+}
+
+std::string langgen::values::Value::type() const {
+	switch(this->valueTag) {
+		case Tag::NUMBER:
+			return "NumberValue";
+		case Tag::BOOLEAN:
+			return "BooleanValue";
+		case Tag::OBJECT:
+			return this->objectValue->type();
+		default:
+			return "NullValue";
+	}
+}
+std::string langgen::values::Value::repr() const {
+	switch(this->valueTag) {
+		case Tag::NUMBER:
+			return std::to_string(this->numberValue);
+		case Tag::BOOLEAN:
+			return this->booleanValue ? "true" : "false";
+		case Tag::OBJECT:
+			return this->objectValue->repr();
+		default:
+			return "null";
+	}
+}
+bool langgen::values::Value::IsTrue() const {
+	switch(this->valueTag) {
+		case Tag::NUMBER:
+			return this->numberValue != 0;
+		case Tag::BOOLEAN:
+			return this->booleanValue;
+		case Tag::OBJECT:
+			return this->objectValue->IsTrue();
+		default:
+			return false;
+	}
+}
+
 #pragma endregion
\ No newline at end of file
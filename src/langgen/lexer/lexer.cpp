@@ -1,5 +1,19 @@
 #include <AquIce/langgen/lexer.hpp>
 
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LANGGEN_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LANGGEN_SIMD_SSE2
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 [[nodiscard]] char peek(std::string str) {
 	return str.at(0);
 }
@@ -23,6 +37,48 @@ bool startswith(std::string str, std::string substr) {
 	return str.rfind(substr, 0) == 0;
 }
 
+bool startswith(std::string_view str, std::string_view substr) {
+	return str.substr(0, substr.length()) == substr;
+}
+
+typedef struct TokenKindRegistry {
+	std::mutex mutex;
+	std::unordered_map<std::string, langgen::lexer::TokenKind> kinds;
+	std::vector<std::string> names;
+} TokenKindRegistry;
+
+TokenKindRegistry& token_kind_registry() {
+	static TokenKindRegistry registry = TokenKindRegistry{
+		{},
+		{ { "EOF", langgen::lexer::EOF_TOKEN_KIND } },
+		{ "EOF" }
+	};
+	return registry;
+}
+
+langgen::lexer::TokenKind langgen::lexer::token_kind(const std::string& name) {
+	TokenKindRegistry& registry = token_kind_registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	auto kind = registry.kinds.find(name);
+	if(kind != registry.kinds.end()) {
+		return kind->second;
+	}
+
+	registry.names.push_back(name);
+	return registry.kinds[name] = registry.names.size() - 1;
+}
+
+const std::string& langgen::lexer::token_kind_name(langgen::lexer::TokenKind kind) {
+	TokenKindRegistry& registry = token_kind_registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	if(kind >= registry.names.size()) {
+		throw std::runtime_error("Unknown token kind " + std::to_string(kind));
+	}
+	return registry.names[kind];
+}
+
 std::string langgen::lexer::repr(const langgen::lexer::Token& token) {
 	std::string pretty = "Type: " + token.type;
 	pretty += "\nValue: " + token.value;
@@ -30,36 +86,93 @@ std::string langgen::lexer::repr(const langgen::lexer::Token& token) {
 }
 
 langgen::lexer::TokenType langgen::lexer::make_token_type(std::string name) {
-	return langgen::lexer::TokenType{
-		name,
-		[name](std::string src) -> std::string {
-			if(startswith(src, name)) {
-				return name;
-			}
-			return "";
-		}
-	};
+	return langgen::lexer::make_token_type(name, name);
 }
 
 langgen::lexer::TokenType langgen::lexer::make_token_type(std::string name, std::string value) {
+	langgen::lexer::TokenType tokenType = langgen::lexer::make_token_type(
+		name,
+		langgen::lexer::MatchTokenFunction([value](std::string_view src) -> size_t {
+			return startswith(src, value) ? value.length() : 0;
+		})
+	);
+	tokenType.literal = value;
+	return tokenType;
+}
+
+langgen::lexer::TokenType langgen::lexer::make_token_type(std::string name, langgen::lexer::LexTokenFunction lex_token) {
 	return langgen::lexer::TokenType{
 		name,
-		[value](std::string src) -> std::string {
-			if(startswith(src, value)) {
-				return value;
-			}
-			return "";
-		}
+		lex_token,
+		// Adapter for the legacy signature, the remaining source still has to be copied
+		[lex_token](std::string_view src) -> size_t {
+			return lex_token(std::string(src)).length();
+		},
+		"",
+		langgen::lexer::token_kind(name)
 	};
 }
 
-langgen::lexer::TokenType langgen::lexer::make_token_type(std::string name, std::function<std::string(std::string)> lex_token) {
+langgen::lexer::TokenType langgen::lexer::make_token_type(std::string name, langgen::lexer::MatchTokenFunction match_token) {
 	return langgen::lexer::TokenType{
 		name,
-		lex_token
+		[match_token](std::string src) -> std::string {
+			return src.substr(0, match_token(src));
+		},
+		match_token,
+		"",
+		langgen::lexer::token_kind(name)
 	};
 }
 
+bool compare_trie_edge(const std::pair<char, size_t>& edge, char c) {
+	return edge.first < c;
+}
+
+void langgen::lexer::compile_token_types(langgen::lexer::Lexer& lexer) {
+	lexer.literalTrie = std::vector<langgen::lexer::TokenTrieNode>(1);
+	lexer.customTokenTypes.clear();
+
+	lexer.charClasses.fill(0);
+	for(char c : lexer.whitespaces) {
+		lexer.charClasses[static_cast<unsigned char>(c)] |= langgen::lexer::WHITESPACE_CHAR;
+	}
+	for(const std::string* delimiter : { &lexer.singleLineComment, &lexer.multiLineComment.first, &lexer.multiLineComment.second }) {
+		if(delimiter->length() != 0) {
+			lexer.charClasses[static_cast<unsigned char>(delimiter->front())] |= langgen::lexer::COMMENT_CHAR;
+		}
+	}
+
+	for(size_t index = 0; index < lexer.tokenTypes.size(); index++) {
+		if(lexer.tokenTypes.at(index).kind == langgen::lexer::NO_TOKEN_KIND) {
+			lexer.tokenTypes.at(index).kind = langgen::lexer::token_kind(lexer.tokenTypes.at(index).name);
+		}
+
+		const std::string& literal = lexer.tokenTypes.at(index).literal;
+
+		if(literal.length() == 0) {
+			lexer.customTokenTypes.push_back(index);
+			continue;
+		}
+
+		size_t node = 0;
+		for(char c : literal) {
+			std::vector<std::pair<char, size_t>>& children = lexer.literalTrie.at(node).children;
+			auto child = std::lower_bound(children.begin(), children.end(), c, &compare_trie_edge);
+			if(child == children.end() || child->first != c) {
+				child = children.insert(child, { c, lexer.literalTrie.size() });
+				node = child->second;
+				lexer.literalTrie.push_back(langgen::lexer::TokenTrieNode());
+				continue;
+			}
+			node = child->second;
+		}
+
+		// First declared wins, later duplicates of the same literal are never reached
+		lexer.literalTrie.at(node).tokenType = std::min(lexer.literalTrie.at(node).tokenType, index);
+	}
+}
+
 void langgen::lexer::setup_lexer(
 	langgen::lexer::Lexer& lexer,
 	const std::vector<langgen::lexer::TokenType>& tokenTypes,
@@ -79,76 +192,576 @@ void langgen::lexer::setup_lexer(
 	lexer.charDelimiter = charDelimiter;
 	lexer.stringDelimiter = stringDelimiter;
 	lexer.escapeCharacter = escapeCharacter;
+	langgen::lexer::compile_token_types(lexer);
 }
 
-void langgen::lexer::lex(
-	langgen::lexer::Lexer& lexer,
-	std::vector<langgen::lexer::Token>& tokens,
-	std::string src
+#pragma region Byte scanning
+
+// Blocks of bytes compared at once, with a mask of the equal bytes (one bit per byte)
+
+#if defined(LANGGEN_SIMD_AVX2)
+
+typedef __m256i ByteBlock;
+
+const size_t BYTE_BLOCK_SIZE = 32;
+const uint32_t FULL_BLOCK_MASK = 0xffffffff;
+
+static inline ByteBlock load_block(const char* bytes) {
+	return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+}
+
+static inline ByteBlock repeat_byte(char byte) {
+	return _mm256_set1_epi8(byte);
+}
+
+static inline uint32_t equal_mask(ByteBlock block, ByteBlock bytes) {
+	return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, bytes)));
+}
+
+#elif defined(LANGGEN_SIMD_SSE2)
+
+typedef __m128i ByteBlock;
+
+const size_t BYTE_BLOCK_SIZE = 16;
+const uint32_t FULL_BLOCK_MASK = 0xffff;
+
+static inline ByteBlock load_block(const char* bytes) {
+	return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+}
+
+static inline ByteBlock repeat_byte(char byte) {
+	return _mm_set1_epi8(byte);
+}
+
+static inline uint32_t equal_mask(ByteBlock block, ByteBlock bytes) {
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, bytes)));
+}
+
+#endif
+
+#if defined(LANGGEN_SIMD_AVX2) || defined(LANGGEN_SIMD_SSE2)
+
+/**
+ * Get the index of the lowest set bit of a non-zero mask
+ */
+static inline size_t first_bit(uint32_t mask) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+/**
+ * The most whitespaces compared at once, lexers with more of them skip whitespaces one character at a time
+ */
+const size_t MAX_BLOCK_WHITESPACES = 8;
+
+#endif
+
+/**
+ * Skip a run of whitespaces
+ * @param position The position of the first whitespace of the run
+ * @return The position of the first character after the run
+ */
+static size_t skip_whitespaces(
+	const langgen::lexer::Lexer& lexer,
+	std::string_view src,
+	size_t position
 ) {
-	while(src.length() > 0) {
+	// Most runs are a single whitespace between two tokens
+	position++;
+	if(position >= src.length() || !(lexer.charClasses[static_cast<unsigned char>(src[position])] & langgen::lexer::WHITESPACE_CHAR)) {
+		return position;
+	}
 
-		// * Check for skippable characters
+#if defined(LANGGEN_SIMD_AVX2) || defined(LANGGEN_SIMD_SSE2)
+	size_t whitespaceCount = lexer.whitespaces.size();
+	if(whitespaceCount <= MAX_BLOCK_WHITESPACES) {
+		ByteBlock whitespaces[MAX_BLOCK_WHITESPACES];
+		for(size_t i = 0; i < whitespaceCount; i++) {
+			whitespaces[i] = repeat_byte(lexer.whitespaces[i]);
+		}
 
-		while(std::find(lexer.whitespaces.begin(), lexer.whitespaces.end(), peek(src)) != lexer.whitespaces.end()) {
-			(void)shift(src);
+		while(position + BYTE_BLOCK_SIZE <= src.length()) {
+			ByteBlock block = load_block(src.data() + position);
+			uint32_t mask = 0;
+			for(size_t i = 0; i < whitespaceCount; i++) {
+				mask |= equal_mask(block, whitespaces[i]);
+			}
+			if(mask != FULL_BLOCK_MASK) {
+				return position + first_bit(~mask & FULL_BLOCK_MASK);
+			}
+			position += BYTE_BLOCK_SIZE;
 		}
+	}
+#endif
 
-		// * Check for comments
+	while(position < src.length() && (lexer.charClasses[static_cast<unsigned char>(src[position])] & langgen::lexer::WHITESPACE_CHAR)) {
+		position++;
+	}
+	return position;
+}
 
-		// Single line
-		if(startswith(src, lexer.singleLineComment)) {
-			while(peek(src) != '\n' && src.length() > 0) {
-				(void)shift(src);
+/**
+ * Find the first occurrence of a character, from a position
+ * @return The position of the character, std::string_view::npos if there is none
+ */
+static size_t find_byte(
+	std::string_view src,
+	size_t position,
+	char byte
+) {
+#if defined(LANGGEN_SIMD_AVX2) || defined(LANGGEN_SIMD_SSE2)
+	ByteBlock bytes = repeat_byte(byte);
+	while(position + BYTE_BLOCK_SIZE <= src.length()) {
+		uint32_t mask = equal_mask(load_block(src.data() + position), bytes);
+		if(mask != 0) {
+			return position + first_bit(mask);
+		}
+		position += BYTE_BLOCK_SIZE;
+	}
+#endif
+	return src.find(byte, position);
+}
+
+/**
+ * Find the first occurrence of a non-empty delimiter, from a position
+ * @return The position of the delimiter, std::string_view::npos if there is none
+ * @note Blocks are matched on the first and last characters of the delimiter, then the candidates are compared
+ */
+static size_t find_delimiter(
+	std::string_view src,
+	size_t position,
+	std::string_view delimiter
+) {
+#if defined(LANGGEN_SIMD_AVX2) || defined(LANGGEN_SIMD_SSE2)
+	size_t last = delimiter.length() - 1;
+	ByteBlock firstBytes = repeat_byte(delimiter.front());
+	ByteBlock lastBytes = repeat_byte(delimiter.back());
+
+	while(position + last + BYTE_BLOCK_SIZE <= src.length()) {
+		uint32_t mask =
+			equal_mask(load_block(src.data() + position), firstBytes) &
+			equal_mask(load_block(src.data() + position + last), lastBytes);
+		while(mask != 0) {
+			size_t candidate = position + first_bit(mask);
+			if(src.compare(candidate, delimiter.length(), delimiter) == 0) {
+				return candidate;
 			}
+			mask &= mask - 1;
+		}
+		position += BYTE_BLOCK_SIZE;
+	}
+#endif
+	return src.find(delimiter, position);
+}
+
+#pragma endregion
+
+/**
+ * Lex the next token of a source, skipping the whitespaces and comments before it
+ * @param position The position of the cursor, moved past the token
+ * @param tokens The list to append the token to
+ * @return Whether a token was appended, false at the end of the source
+ */
+static bool lex_next(
+	langgen::lexer::Lexer& lexer,
+	std::string_view src,
+	size_t& position,
+	std::vector<langgen::lexer::Token>& tokens
+) {
+	if(lexer.literalTrie.size() == 0) {
+		langgen::lexer::compile_token_types(lexer);
+	}
+
+	// `rest` is always a view from the cursor to the end of the source
+	while(position < src.length()) {
+		unsigned char charClass = lexer.charClasses[static_cast<unsigned char>(src[position])];
+
+		// * Check for skippable characters
+
+		if(charClass & langgen::lexer::WHITESPACE_CHAR) {
+			position = skip_whitespaces(lexer, src, position);
 			continue;
 		}
 
-		// Multi line open
-		if(startswith(src, lexer.multiLineComment.first)) {
-			while(!startswith(src, lexer.multiLineComment.second)) {
-				try {
-					(void)shift(src);
-				} catch(const std::exception& e) {
+		std::string_view rest = src.substr(position);
+
+		// * Check for comments, only at the characters starting a delimiter
+
+		if(charClass & langgen::lexer::COMMENT_CHAR) {
+			// Single line
+			if(lexer.singleLineComment.length() != 0 && startswith(rest, lexer.singleLineComment)) {
+				size_t end = find_byte(src, position, '\n');
+				position = end == std::string_view::npos ? src.length() : end;
+				continue;
+			}
+
+			// Multi line open
+			if(lexer.multiLineComment.first.length() != 0 && startswith(rest, lexer.multiLineComment.first)) {
+				size_t end = lexer.multiLineComment.second.length() == 0 ?
+					std::string_view::npos :
+					find_delimiter(src, position, lexer.multiLineComment.second);
+				if(end == std::string_view::npos) {
 					throw std::runtime_error("Comment being opened and not closed before EOF");
 				}
+				position = end + lexer.multiLineComment.second.length();
+				continue;
+			}
+			if(lexer.multiLineComment.second.length() != 0 && startswith(rest, lexer.multiLineComment.second)) {
+				throw std::runtime_error("Comment being closed without being opened");
 			}
-			(void)shift(src, lexer.multiLineComment.second.length());
-			continue;
-		}
-		if(startswith(src, lexer.multiLineComment.second)) {
-			(void)shift(src, lexer.multiLineComment.second.length());
-			throw std::runtime_error("Comment being closed without being opened");
 		}
 
 		// Lex token
 
-		bool tokenFound = false;
-
-		for(const langgen::lexer::TokenType& tokenType : lexer.tokenTypes) {
-			std::string tokenValue = tokenType.lex_token(src);
-			if(tokenValue.length() != 0) {
-				(void)shift(src, tokenValue.length());
-				tokens.push_back(
-					langgen::lexer::Token{
-						tokenType.name,
-						tokenValue
-					}
-				);
-				tokenFound = true;
+		// Literal token types : walk the trie, keeping the first declared literal matching at this position
+		size_t tokenIndex = std::string::npos;
+		size_t tokenLength = 0;
+
+		size_t node = 0;
+		for(size_t i = 0; i < rest.length(); i++) {
+			const std::vector<std::pair<char, size_t>>& children = lexer.literalTrie[node].children;
+			auto child = std::lower_bound(children.begin(), children.end(), rest[i], &compare_trie_edge);
+			if(child == children.end() || child->first != rest[i]) {
 				break;
 			}
+			node = child->second;
+			if(lexer.literalTrie[node].tokenType < tokenIndex) {
+				tokenIndex = lexer.literalTrie[node].tokenType;
+				tokenLength = i + 1;
+			}
 		}
 
-		if(tokenFound) {
-			continue;
+		// Custom token types : only the ones declared before the literal match can take priority over it
+		for(size_t index : lexer.customTokenTypes) {
+			if(index > tokenIndex) {
+				break;
+			}
+			const langgen::lexer::TokenType& tokenType = lexer.tokenTypes[index];
+			size_t length = tokenType.match_token ?
+				tokenType.match_token(rest) :
+				tokenType.lex_token(std::string(rest)).length();
+			if(length != 0) {
+				tokenIndex = index;
+				tokenLength = length;
+				break;
+			}
+		}
+
+		if(tokenLength != 0) {
+			LANGGEN_STATS_RECORD(stats, langgen::stats::count(stats->tokens, lexer.tokenTypes[tokenIndex].kind));
+			tokens.push_back(
+				langgen::lexer::Token{
+					lexer.tokenTypes[tokenIndex].name,
+					std::string(rest.substr(0, tokenLength)),
+					lexer.tokenTypes[tokenIndex].kind,
+					position
+				}
+			);
+			position += tokenLength;
+			return true;
 		}
 
-		throw std::runtime_error("Unknown token in \"" + src + "\"");
+		throw std::runtime_error("Unknown token in \"" + std::string(rest) + "\"");
 	}
 
+	return false;
+}
+
+void langgen::lexer::lex(
+	langgen::lexer::Lexer& lexer,
+	std::vector<langgen::lexer::Token>& tokens,
+	std::string_view src,
+	langgen::stats::Stats* stats
+) {
+	langgen::stats::PhaseRecorder recorder(stats, langgen::stats::Phase::LEX);
+
+	// The cursor walks the original buffer
+	size_t position = 0;
+
+	while(lex_next(lexer, src, position, tokens)) {}
+
 	tokens.push_back(Token{
 		"EOF",
-		""
+		"",
+		langgen::lexer::EOF_TOKEN_KIND,
+		src.length()
+	});
+}
+
+langgen::lexer::Edit langgen::lexer::relex(
+	langgen::lexer::Lexer& lexer,
+	std::vector<langgen::lexer::Token>& tokens,
+	std::string_view src,
+	const langgen::lexer::Edit& edit
+) {
+	if(tokens.size() == 0 || tokens.back().kind != langgen::lexer::EOF_TOKEN_KIND) {
+		throw std::runtime_error("Trying to relex tokens not ending with EOF");
+	}
+	if(edit.offset + edit.inserted > src.length()) {
+		throw std::runtime_error("Trying to relex an edit past the end of the source");
+	}
+
+	size_t editEnd = edit.offset + edit.inserted;
+
+	// The tokens before the edit keep their offset, restart from the second to last of them
+	size_t first = std::lower_bound(
+		tokens.begin(),
+		tokens.end() - 1,
+		edit.offset,
+		[](const langgen::lexer::Token& token, size_t offset) { return token.offset < offset; }
+	) - tokens.begin();
+	first = first >= 2 ? first - 2 : 0;
+
+	size_t position = first == 0 ? 0 : tokens[first].offset;
+
+	std::vector<langgen::lexer::Token> lexed;
+	size_t next = first;
+
+	while(true) {
+		if(!lex_next(lexer, src, position, lexed)) {
+			lexed.push_back(langgen::lexer::Token{
+				"EOF",
+				"",
+				langgen::lexer::EOF_TOKEN_KIND,
+				src.length()
+			});
+			next = tokens.size();
+			break;
+		}
+
+		size_t offset = lexed.back().offset;
+		if(offset < editEnd) {
+			continue;
+		}
+
+		// Past the edit, both sources are the same : lexing from where an old token started gives the old tokens
+		size_t oldOffset = offset - edit.inserted + edit.removed;
+		while(next < tokens.size() - 1 && tokens[next].offset < oldOffset) {
+			next++;
+		}
+		if(next < tokens.size() - 1 && tokens[next].offset == oldOffset) {
+			lexed.pop_back();
+			break;
+		}
+	}
+
+	if(edit.removed != edit.inserted) {
+		for(size_t i = next; i < tokens.size(); i++) {
+			tokens[i].offset = tokens[i].offset - edit.removed + edit.inserted;
+		}
+	}
+
+	// Replace in place what can be, to only move the following tokens when the count changes
+	size_t removed = next - first;
+	size_t common = std::min(removed, lexed.size());
+	std::move(lexed.begin(), lexed.begin() + common, tokens.begin() + first);
+	if(removed > common) {
+		tokens.erase(tokens.begin() + first + common, tokens.begin() + next);
+	} else {
+		tokens.insert(
+			tokens.begin() + next,
+			std::make_move_iterator(lexed.begin() + common),
+			std::make_move_iterator(lexed.end())
+		);
+	}
+
+	return langgen::lexer::Edit{first, removed, lexed.size()};
+}
+
+void langgen::lexer::lex_file(
+	langgen::lexer::Lexer& lexer,
+	std::vector<langgen::lexer::Token>& tokens,
+	const std::string& path
+) {
+	langgen::lexer::MappedSource source(path);
+
+	langgen::lexer::lex(lexer, tokens, source.view());
+}
+
+/**
+ * Skip a comment or a delimited char / string starting at a position, newlines inside of them can not be split at
+ * @return The position right after it, the end of the source if it is not closed, or `position` itself if none starts there
+ */
+static size_t skip_unsplittable(
+	const langgen::lexer::Lexer& lexer,
+	std::string_view src,
+	size_t position
+) {
+	char c = src[position];
+
+	// Comments : a single line comment ends on the next newline, which is itself safe
+	if(!lexer.singleLineComment.empty() && startswith(src.substr(position), lexer.singleLineComment)) {
+		size_t end = src.find('\n', position);
+		return end == std::string_view::npos ? src.length() : end;
+	}
+	if(!lexer.multiLineComment.first.empty() && startswith(src.substr(position), lexer.multiLineComment.first)) {
+		// Searched from the opening, as `lex` does
+		size_t end = src.find(lexer.multiLineComment.second, position);
+		return end == std::string_view::npos ? src.length() : end + lexer.multiLineComment.second.length();
+	}
+
+	// Delimited chars / strings, which may contain newlines
+	if(c == lexer.stringDelimiter || c == lexer.charDelimiter) {
+		position++;
+		while(position < src.length() && src[position] != c) {
+			position += src[position] == lexer.escapeCharacter ? 2 : 1;
+		}
+		return std::min(position + 1, src.length());
+	}
+
+	return position;
+}
+
+/**
+ * Check whether a lexer can split a source at newlines
+ */
+static bool splits_at_newlines(const langgen::lexer::Lexer& lexer) {
+	return std::find(lexer.whitespaces.begin(), lexer.whitespaces.end(), '\n') != lexer.whitespaces.end();
+}
+
+/**
+ * Find where to split a source into chunks which can be lexed independently
+ * @param chunks The number of chunks wanted
+ * @return The start of every chunk but the first one, each right after a newline found outside of comments and delimiters
+ * @note Fewer boundaries are returned when there are not enough safe newlines
+ */
+static std::vector<size_t> find_safe_boundaries(
+	const langgen::lexer::Lexer& lexer,
+	std::string_view src,
+	size_t chunks
+) {
+	std::vector<size_t> boundaries;
+
+	if(chunks < 2 || !splits_at_newlines(lexer)) {
+		return boundaries;
+	}
+
+	size_t target = src.length() / chunks;
+	size_t position = 0;
+
+	while(position < src.length() && boundaries.size() < chunks - 1) {
+		if(src[position] == '\n') {
+			if(position + 1 >= target && position + 1 < src.length()) {
+				boundaries.push_back(position + 1);
+				target = (boundaries.size() + 1) * src.length() / chunks;
+			}
+			position++;
+			continue;
+		}
+
+		size_t end = skip_unsplittable(lexer, src, position);
+		position = end == position ? position + 1 : end;
+	}
+
+	return boundaries;
+}
+
+size_t langgen::lexer::safe_prefix_length(
+	const langgen::lexer::Lexer& lexer,
+	std::string_view src
+) {
+	if(!splits_at_newlines(lexer)) {
+		return 0;
+	}
+
+	size_t prefix = 0;
+	size_t position = 0;
+
+	while(position < src.length()) {
+		if(src[position] == '\n') {
+			prefix = ++position;
+			continue;
+		}
+
+		size_t end = skip_unsplittable(lexer, src, position);
+		position = end == position ? position + 1 : end;
+	}
+
+	return prefix;
+}
+
+void langgen::lexer::lex_parallel(
+	langgen::lexer::Lexer& lexer,
+	std::vector<langgen::lexer::Token>& tokens,
+	std::string_view src,
+	size_t threads
+) {
+	if(threads == 0) {
+		threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	}
+	threads = std::min(threads, std::max<size_t>(src.length() / langgen::lexer::PARALLEL_LEX_MIN_CHUNK, 1));
+
+	std::vector<size_t> boundaries = find_safe_boundaries(lexer, src, threads);
+
+	if(boundaries.size() == 0) {
+		langgen::lexer::lex(lexer, tokens, src);
+		return;
+	}
+
+	// Compiled before starting the threads, `lex` would compile it lazily otherwise
+	if(lexer.literalTrie.size() == 0) {
+		langgen::lexer::compile_token_types(lexer);
+	}
+
+	boundaries.insert(boundaries.begin(), 0);
+	boundaries.push_back(src.length());
+
+	size_t chunks = boundaries.size() - 1;
+	std::vector<std::vector<langgen::lexer::Token>> chunkTokens(chunks);
+	std::vector<std::exception_ptr> errors(chunks);
+
+	auto lex_chunk = [&lexer, &src, &boundaries, &chunkTokens, &errors](size_t chunk) {
+		try {
+			langgen::lexer::lex(
+				lexer,
+				chunkTokens[chunk],
+				src.substr(boundaries[chunk], boundaries[chunk + 1] - boundaries[chunk])
+			);
+			// Only the last chunk ends the source
+			chunkTokens[chunk].pop_back();
+			for(langgen::lexer::Token& token : chunkTokens[chunk]) {
+				token.offset += boundaries[chunk];
+			}
+		} catch(...) {
+			errors[chunk] = std::current_exception();
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for(size_t chunk = 1; chunk < chunks; chunk++) {
+		workers.push_back(std::thread(lex_chunk, chunk));
+	}
+	lex_chunk(0);
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+
+	for(const std::exception_ptr& error : errors) {
+		if(error != nullptr) {
+			langgen::lexer::lex(lexer, tokens, src);
+			return;
+		}
+	}
+
+	size_t tokenCount = 1;
+	for(const std::vector<langgen::lexer::Token>& chunk : chunkTokens) {
+		tokenCount += chunk.size();
+	}
+	tokens.reserve(tokens.size() + tokenCount);
+
+	for(std::vector<langgen::lexer::Token>& chunk : chunkTokens) {
+		std::move(chunk.begin(), chunk.end(), std::back_inserter(tokens));
+	}
+
+	tokens.push_back(langgen::lexer::Token{
+		"EOF",
+		"",
+		langgen::lexer::EOF_TOKEN_KIND,
+		src.length()
 	});
 }
\ No newline at end of file
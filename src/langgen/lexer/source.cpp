@@ -0,0 +1,106 @@
+#include <AquIce/langgen/source.hpp>
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+langgen::lexer::MappedSource::MappedSource(const std::string& path) {
+	this->data = nullptr;
+	this->length = 0;
+	this->mapping = nullptr;
+
+	this->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(this->file == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("Could not open file " + path);
+	}
+
+	LARGE_INTEGER size;
+	if(!GetFileSizeEx(this->file, &size)) {
+		CloseHandle(this->file);
+		throw std::runtime_error("Could not get the size of file " + path);
+	}
+	this->length = static_cast<size_t>(size.QuadPart);
+
+	// Empty files can not be mapped
+	if(this->length == 0) {
+		return;
+	}
+
+	this->mapping = CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if(this->mapping == nullptr) {
+		CloseHandle(this->file);
+		throw std::runtime_error("Could not map file " + path);
+	}
+
+	this->data = static_cast<const char*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+	if(this->data == nullptr) {
+		CloseHandle(this->mapping);
+		CloseHandle(this->file);
+		throw std::runtime_error("Could not map file " + path);
+	}
+}
+
+langgen::lexer::MappedSource::~MappedSource() {
+	if(this->data != nullptr) {
+		UnmapViewOfFile(this->data);
+	}
+	if(this->mapping != nullptr) {
+		CloseHandle(this->mapping);
+	}
+	CloseHandle(this->file);
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+langgen::lexer::MappedSource::MappedSource(const std::string& path) {
+	this->data = nullptr;
+	this->length = 0;
+
+	this->file = open(path.c_str(), O_RDONLY);
+	if(this->file < 0) {
+		throw std::runtime_error("Could not open file " + path);
+	}
+
+	struct stat status;
+	if(fstat(this->file, &status) != 0) {
+		close(this->file);
+		throw std::runtime_error("Could not get the size of file " + path);
+	}
+	this->length = static_cast<size_t>(status.st_size);
+
+	// Empty files can not be mapped
+	if(this->length == 0) {
+		return;
+	}
+
+	void* mapped = mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, this->file, 0);
+	if(mapped == MAP_FAILED) {
+		close(this->file);
+		throw std::runtime_error("Could not map file " + path);
+	}
+	// The source is read once from start to end
+	madvise(mapped, this->length, MADV_SEQUENTIAL);
+	this->data = static_cast<const char*>(mapped);
+}
+
+langgen::lexer::MappedSource::~MappedSource() {
+	if(this->data != nullptr) {
+		munmap(const_cast<char*>(this->data), this->length);
+	}
+	close(this->file);
+}
+
+#endif
+
+std::string_view langgen::lexer::MappedSource::view() const {
+	return std::string_view(this->data, this->data == nullptr ? 0 : this->length);
+}
+
+size_t langgen::lexer::MappedSource::size() const {
+	return this->length;
+}
@@ -0,0 +1,99 @@
+#include <AquIce/langgen/lexer.hpp>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+langgen::lexer::TokenSource::TokenSource(
+	langgen::lexer::Lexer& lexer,
+	std::istream& input,
+	size_t chunkSize
+) : lexer(lexer), input(&input), fd(-1), chunkSize(std::max<size_t>(chunkSize, 1)) {}
+
+langgen::lexer::TokenSource::TokenSource(
+	langgen::lexer::Lexer& lexer,
+	int fd,
+	size_t chunkSize
+) : lexer(lexer), input(nullptr), fd(fd), chunkSize(std::max<size_t>(chunkSize, 1)) {}
+
+size_t langgen::lexer::TokenSource::read_chunk() {
+	size_t size = this->pending.length();
+	this->pending.resize(size + this->chunkSize);
+
+	size_t count = 0;
+
+	if(this->input != nullptr) {
+		this->input->read(&this->pending[size], static_cast<std::streamsize>(this->chunkSize));
+		count = static_cast<size_t>(this->input->gcount());
+		if(this->input->bad()) {
+			throw std::runtime_error("Could not read the input stream");
+		}
+	} else {
+#ifdef _WIN32
+		int result = _read(this->fd, &this->pending[size], static_cast<unsigned int>(this->chunkSize));
+#else
+		ssize_t result;
+		do {
+			result = read(this->fd, &this->pending[size], this->chunkSize);
+		} while(result < 0 && errno == EINTR);
+#endif
+		if(result < 0) {
+			throw std::runtime_error("Could not read file descriptor " + std::to_string(this->fd));
+		}
+		count = static_cast<size_t>(result);
+	}
+
+	this->pending.resize(size + count);
+	return count;
+}
+
+bool langgen::lexer::TokenSource::fill(std::vector<langgen::lexer::Token>& tokens) {
+	if(this->finished) {
+		return false;
+	}
+
+	std::vector<langgen::lexer::Token> chunkTokens;
+
+	while(true) {
+		bool end = this->read_chunk() == 0;
+
+		// The rest of the input is lexed at once, ending with the EOF token
+		size_t length = end ?
+			this->pending.length() :
+			langgen::lexer::safe_prefix_length(this->lexer, this->pending);
+
+		if(length == 0 && !end) {
+			continue;
+		}
+
+		langgen::lexer::lex(this->lexer, chunkTokens, std::string_view(this->pending).substr(0, length));
+		if(!end) {
+			chunkTokens.pop_back();
+		}
+
+		tokens.reserve(tokens.size() + chunkTokens.size());
+		for(langgen::lexer::Token& token : chunkTokens) {
+			token.offset += this->consumed;
+			tokens.push_back(std::move(token));
+		}
+
+		this->pending.erase(0, length);
+		this->consumed += length;
+
+		if(end) {
+			this->finished = true;
+			return true;
+		}
+		if(chunkTokens.size() != 0) {
+			return true;
+		}
+		chunkTokens.clear();
+	}
+}
+
+bool langgen::lexer::TokenSource::done() const {
+	return this->finished;
+}
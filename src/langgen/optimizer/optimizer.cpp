@@ -0,0 +1,151 @@
+#include <AquIce/langgen/optimizer.hpp>
+
+void langgen::optimizer::setup_optimizer(
+	langgen::optimizer::Optimizer& optimizer,
+	langgen::interpreter::Interpreter& interpreter,
+	std::unordered_map<std::string, langgen::optimizer::FoldStatementFunction> nodeFoldFunctions,
+	std::vector<langgen::optimizer::LiteralType> literalTypes
+) {
+	optimizer.interpreter = &interpreter;
+
+	optimizer.nodeFoldFunctions = nodeFoldFunctions;
+	optimizer.nodeFoldFunctions["Scope"] = [] (
+		langgen::optimizer::Optimizer& optimizer,
+		const std::shared_ptr<langgen::ast::Statement>& statement
+	) -> std::shared_ptr<langgen::ast::Statement> {
+		langgen::optimizer::fold_scope(
+			optimizer,
+			std::dynamic_pointer_cast<langgen::ast::Scope>(statement)
+		);
+		return statement;
+	};
+
+	optimizer.literalTypes = std::vector<langgen::optimizer::LiteralType>({
+		langgen::optimizer::LiteralType{
+			"NumberExpression",
+			[] (const langgen::values::Value& value) -> std::shared_ptr<langgen::ast::Statement> {
+				if(!value.is_number()) {
+					return nullptr;
+				}
+				return langgen::ast::make<langgen::ast::NumberExpression>(value.get_number());
+			}
+		}
+	});
+	optimizer.literalTypes.insert(optimizer.literalTypes.end(), literalTypes.begin(), literalTypes.end());
+
+	optimizer.passes.clear();
+	langgen::optimizer::add_pass(
+		optimizer,
+		"fold",
+		[] (langgen::optimizer::Optimizer& optimizer, std::shared_ptr<langgen::ast::Scope> program) {
+			optimizer.scopes.clear();
+			langgen::optimizer::fold_scope(optimizer, program);
+		}
+	);
+}
+
+void langgen::optimizer::add_pass(
+	langgen::optimizer::Optimizer& optimizer,
+	std::string name,
+	langgen::optimizer::PassFunction run
+) {
+	optimizer.passes.push_back(langgen::optimizer::Pass{name, run});
+}
+
+bool langgen::optimizer::is_literal(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	for(const langgen::optimizer::LiteralType& literalType : optimizer.literalTypes) {
+		if(statement->type() == literalType.nodeType) {
+			return true;
+		}
+	}
+	return false;
+}
+
+std::shared_ptr<langgen::ast::Statement> langgen::optimizer::fold_constant(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	langgen::values::Value value;
+
+	try {
+		value = langgen::interpreter::evaluate_value(
+			*optimizer.interpreter,
+			statement,
+			std::make_shared<langgen::env::Environment>(
+				langgen::interpreter::get_env_schema(*optimizer.interpreter)
+			)
+		);
+	} catch(const std::exception& e) {
+		// Left to the interpreter, which reports the error when the statement is evaluated
+		return statement;
+	}
+
+	for(const langgen::optimizer::LiteralType& literalType : optimizer.literalTypes) {
+		std::shared_ptr<langgen::ast::Statement> literal = literalType.make_literal(value);
+		if(literal != nullptr) {
+			return literal;
+		}
+	}
+	return statement;
+}
+
+void langgen::optimizer::declare(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::string& key,
+	std::shared_ptr<langgen::ast::Statement> constant
+) {
+	if(optimizer.scopes.size() == 0) {
+		throw std::runtime_error("Trying to declare " + key + " outside of a scope");
+	}
+	optimizer.scopes.back()[key] = constant;
+}
+
+std::shared_ptr<langgen::ast::Statement> langgen::optimizer::lookup_constant(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::string& key
+) {
+	for(size_t depth = 0; depth < optimizer.scopes.size(); depth++) {
+		const std::unordered_map<std::string, std::shared_ptr<langgen::ast::Statement>>& scope = optimizer.scopes.at(optimizer.scopes.size() - 1 - depth);
+		auto constant = scope.find(key);
+		if(constant != scope.end()) {
+			return constant->second;
+		}
+	}
+	return nullptr;
+}
+
+std::shared_ptr<langgen::ast::Statement> langgen::optimizer::fold_statement(
+	langgen::optimizer::Optimizer& optimizer,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	auto foldFn = optimizer.nodeFoldFunctions.find(statement->type());
+	if(foldFn != optimizer.nodeFoldFunctions.end()) {
+		return foldFn->second(optimizer, statement);
+	}
+	return statement;
+}
+
+void langgen::optimizer::fold_scope(
+	langgen::optimizer::Optimizer& optimizer,
+	std::shared_ptr<langgen::ast::Scope> scope
+) {
+	optimizer.scopes.push_back(std::unordered_map<std::string, std::shared_ptr<langgen::ast::Statement>>());
+
+	for(std::shared_ptr<langgen::ast::Statement>& statement : scope->body) {
+		statement = langgen::optimizer::fold_statement(optimizer, statement);
+	}
+
+	optimizer.scopes.pop_back();
+}
+
+void langgen::optimizer::optimize(
+	langgen::optimizer::Optimizer& optimizer,
+	std::shared_ptr<langgen::ast::Scope> program
+) {
+	for(const langgen::optimizer::Pass& pass : optimizer.passes) {
+		pass.run(optimizer, program);
+	}
+}
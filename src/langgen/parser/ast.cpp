@@ -1,11 +1,117 @@
 #include <AquIce/langgen/ast.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
+
+typedef struct NodeKindRegistry {
+	std::mutex mutex;
+	std::unordered_map<std::string, langgen::ast::NodeKind> kinds;
+	std::vector<std::string> types;
+} NodeKindRegistry;
+
+NodeKindRegistry& node_kind_registry() {
+	static NodeKindRegistry registry;
+	return registry;
+}
+
+langgen::ast::NodeKind langgen::ast::node_kind(const std::string& type) {
+	NodeKindRegistry& registry = node_kind_registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	auto kind = registry.kinds.find(type);
+	if(kind != registry.kinds.end()) {
+		return kind->second;
+	}
+
+	registry.types.push_back(type);
+	return registry.kinds[type] = registry.types.size() - 1;
+}
+
+const std::string& langgen::ast::node_kind_name(langgen::ast::NodeKind kind) {
+	NodeKindRegistry& registry = node_kind_registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	if(kind >= registry.types.size()) {
+		throw std::runtime_error("Unknown node kind " + std::to_string(kind));
+	}
+	return registry.types[kind];
+}
+
+langgen::ast::ArenaMemory::ArenaMemory(size_t blockSize) {
+	this->blockSize = blockSize;
+	this->offset = 0;
+}
+
+void* langgen::ast::ArenaMemory::allocate(size_t size, size_t alignment) {
+	this->references.fetch_add(1, std::memory_order_relaxed);
+
+	if(this->blocks.size() != 0) {
+		size_t aligned = (this->offset + alignment - 1) & ~(alignment - 1);
+		if(aligned + size <= this->blockSizes.back()) {
+			this->offset = aligned + size;
+			return this->blocks.back().get() + aligned;
+		}
+	}
+
+	// Blocks are allocated with new[], which is aligned for any fundamental type
+	size_t blockSize = std::max(this->blockSize, size);
+	this->blocks.push_back(std::make_unique<char[]>(blockSize));
+	this->blockSizes.push_back(blockSize);
+	this->offset = size;
+	return this->blocks.back().get();
+}
+
+void langgen::ast::ArenaMemory::release() {
+	if(this->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		delete this;
+	}
+}
+
+size_t langgen::ast::ArenaMemory::capacity() {
+	size_t capacity = 0;
+	for(size_t blockSize : this->blockSizes) {
+		capacity += blockSize;
+	}
+	return capacity;
+}
+
+langgen::ast::Arena::Arena(size_t blockSize) {
+	this->memory = new langgen::ast::ArenaMemory(blockSize);
+}
+
+langgen::ast::Arena::~Arena() {
+	this->memory->release();
+}
+
+size_t langgen::ast::Arena::capacity() {
+	return this->memory->capacity();
+}
+
 std::string langgen::ast::Statement::type() {
 	return "Statement";
 }
 std::string langgen::ast::Statement::repr(int indent) {
 	return std::string(indent, '\t') + "Statement";
 }
+langgen::ast::NodeKind langgen::ast::Statement::kind() {
+	if(this->nodeKind != langgen::ast::NO_NODE_KIND) {
+		return this->nodeKind;
+	}
+
+	// The Statement is never written to, it may be evaluated on several threads
+	static thread_local std::unordered_map<std::type_index, langgen::ast::NodeKind> classKinds;
+	auto classKind = classKinds.find(typeid(*this));
+	if(classKind != classKinds.end()) {
+		return classKind->second;
+	}
+	return classKinds[typeid(*this)] = langgen::ast::node_kind(this->type());
+}
+void langgen::ast::Statement::set_kind(langgen::ast::NodeKind kind) {
+	this->nodeKind = kind;
+}
 
 langgen::ast::Scope::Scope(std::vector<std::shared_ptr<langgen::ast::Statement>> body) {
 	this->body = body;
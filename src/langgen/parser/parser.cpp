@@ -10,13 +10,120 @@
 	return first;
 }
 
+[[nodiscard]] const langgen::lexer::Token& peek(langgen::parser::TokenStream& tokens) {
+	while(tokens.position >= tokens.tokens.size() && tokens.source != nullptr && tokens.source->fill(tokens.tokens)) {}
+	if(tokens.position >= tokens.tokens.size()) {
+		throw std::runtime_error("Trying to peek past the end of the tokens");
+	}
+	langgen::lexer::Token& token = tokens.tokens[tokens.position];
+	// Tokens built by hand have no kind
+	if(token.kind == langgen::lexer::NO_TOKEN_KIND) {
+		token.kind = langgen::lexer::token_kind(token.type);
+	}
+	return token;
+}
+
+[[nodiscard]] const langgen::lexer::Token& eat(langgen::parser::TokenStream& tokens) {
+	const langgen::lexer::Token& first = peek(tokens);
+	tokens.position++;
+	return first;
+}
+
+size_t langgen::parser::mark(langgen::parser::TokenStream& tokens) {
+	return tokens.base + tokens.position;
+}
+
+void langgen::parser::reset(
+	langgen::parser::TokenStream& tokens,
+	size_t mark
+) {
+	if(mark < tokens.base) {
+		throw std::runtime_error("Trying to backtrack to a compacted token");
+	}
+	tokens.position = mark - tokens.base;
+}
+
+const langgen::lexer::Token& langgen::parser::token_at(
+	langgen::parser::TokenStream& tokens,
+	size_t mark
+) {
+	if(mark < tokens.base || mark - tokens.base >= tokens.tokens.size()) {
+		throw std::runtime_error("Trying to get a token out of the token window");
+	}
+	return tokens.tokens[mark - tokens.base];
+}
+
+void langgen::parser::compact(langgen::parser::TokenStream& tokens) {
+	tokens.tokens.erase(tokens.tokens.begin(), tokens.tokens.begin() + tokens.position);
+	tokens.base += tokens.position;
+	tokens.position = 0;
+}
+
+/**
+ * Wrap a parsing function to memoize its results in the memo of the token stream
+ */
+static langgen::parser::ParseStreamNodeFunction memoize_node(langgen::parser::ParseStreamNodeFunction parse_stream_node) {
+	static std::atomic<size_t> memoizedNodes = 0;
+	size_t id = memoizedNodes++;
+
+	return [parse_stream_node, id](langgen::parser::TokenStream& tokens) -> std::shared_ptr<langgen::ast::Statement> {
+		langgen::parser::MemoKey key = langgen::parser::MemoKey{id, langgen::parser::mark(tokens)};
+
+		auto entry = tokens.memo.find(key);
+		if(entry != tokens.memo.end()) {
+			langgen::parser::reset(tokens, entry->second.end);
+			return entry->second.statement;
+		}
+
+		std::shared_ptr<langgen::ast::Statement> statement = parse_stream_node(tokens);
+		tokens.memo[key] = langgen::parser::MemoEntry{statement, langgen::parser::mark(tokens)};
+		return statement;
+	};
+}
+
 langgen::parser::Node langgen::parser::make_node(
 	langgen::parser::ParseNodeFunction parse_node,
-	bool isTopNode
+	bool isTopNode,
+	bool memoize
 ) {
+	// Adapter for the legacy signature, the consumed tokens have to be erased before the call
+	// A list of tokens cannot be refilled, with a token source the rest of the source is lexed before the call
+	langgen::parser::ParseStreamNodeFunction parse_stream_node = [parse_node](langgen::parser::TokenStream& tokens) -> std::shared_ptr<langgen::ast::Statement> {
+		langgen::parser::compact(tokens);
+		while(tokens.source != nullptr && tokens.source->fill(tokens.tokens)) {}
+		size_t size = tokens.tokens.size();
+		std::shared_ptr<langgen::ast::Statement> statement = parse_node(tokens.tokens);
+		tokens.base += size - tokens.tokens.size();
+		return statement;
+	};
+
 	return langgen::parser::Node{
 		parse_node,
-		isTopNode
+		isTopNode,
+		memoize ? memoize_node(parse_stream_node) : parse_stream_node,
+		memoize
+	};
+}
+
+langgen::parser::Node langgen::parser::make_node(
+	langgen::parser::ParseStreamNodeFunction parse_stream_node,
+	bool isTopNode,
+	bool memoize
+) {
+	if(memoize) {
+		parse_stream_node = memoize_node(parse_stream_node);
+	}
+
+	return langgen::parser::Node{
+		[parse_stream_node](std::vector<langgen::lexer::Token>& tokens) -> std::shared_ptr<langgen::ast::Statement> {
+			langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+			std::shared_ptr<langgen::ast::Statement> statement = parse_stream_node(stream);
+			langgen::parser::compact(stream);
+			return statement;
+		},
+		isTopNode,
+		parse_stream_node,
+		memoize
 	};
 }
 
@@ -25,21 +132,190 @@ void langgen::parser::demoteTopNode(
 	std::string key
 ) {
 	parser.nodesRegister.at(key).isTopNode = false;
+	langgen::parser::compile_dispatch(parser);
 }
 
 std::shared_ptr<langgen::ast::Expression> langgen::parser::parse_number_expression(std::vector<langgen::lexer::Token>& tokens) {
 	if(peek(tokens).type == "NUMBER") {
-		return std::make_shared<langgen::ast::NumberExpression>(std::stod(eat(tokens).value));
+		return langgen::ast::make<langgen::ast::NumberExpression>(std::stod(eat(tokens).value));
+	}
+	return nullptr;
+}
+
+std::shared_ptr<langgen::ast::Expression> langgen::parser::parse_number_expression(langgen::parser::TokenStream& tokens) {
+	static const langgen::lexer::TokenKind NUMBER = langgen::lexer::token_kind("NUMBER");
+
+	if(peek(tokens).kind == NUMBER) {
+		return langgen::parser::make_statement<langgen::ast::NumberExpression>(tokens, std::stod(eat(tokens).value));
+	}
+	return nullptr;
+}
+
+langgen::parser::BinaryOperator langgen::parser::make_binary_operator(
+	std::string tokenType,
+	std::string value,
+	int precedence,
+	langgen::parser::Associativity associativity,
+	langgen::parser::BuildBinaryFunction build
+) {
+	return langgen::parser::BinaryOperator{
+		langgen::lexer::token_kind(tokenType),
+		value,
+		precedence,
+		associativity,
+		build
+	};
+}
+
+const langgen::parser::BinaryOperator* langgen::parser::find_binary_operator(
+	const langgen::parser::OperatorTable& table,
+	const langgen::lexer::Token& token
+) {
+	for(const langgen::parser::BinaryOperator& binaryOperator : table.binaryOperators) {
+		if(binaryOperator.kind == token.kind && (binaryOperator.value.empty() || binaryOperator.value == token.value)) {
+			return &binaryOperator;
+		}
 	}
 	return nullptr;
 }
 
+std::shared_ptr<langgen::ast::Expression> langgen::parser::parse_expression(
+	const langgen::parser::OperatorTable& table,
+	langgen::parser::TokenStream& tokens,
+	int minPrecedence
+) {
+	std::shared_ptr<langgen::ast::Expression> first = std::static_pointer_cast<langgen::ast::Expression>(table.parse_operand(tokens));
+	if(first == nullptr) {
+		return nullptr;
+	}
+
+	std::vector<std::shared_ptr<langgen::ast::Expression>> operands = { first };
+	// The operators waiting for their right operand, with the mark of their token
+	std::vector<std::pair<const langgen::parser::BinaryOperator*, size_t>> operators;
+
+	// Replace the two last operands with the operation of the last operator
+	auto reduce = [&tokens, &operands, &operators]() {
+		std::shared_ptr<langgen::ast::Expression> right = std::move(operands.back());
+		operands.pop_back();
+		operands.back() = operators.back().first->build(tokens, operands.back(), langgen::parser::token_at(tokens, operators.back().second), right);
+		operators.pop_back();
+	};
+
+	while(true) {
+		const langgen::parser::BinaryOperator* binaryOperator = langgen::parser::find_binary_operator(table, peek(tokens));
+		if(binaryOperator == nullptr || binaryOperator->precedence < minPrecedence) {
+			break;
+		}
+
+		while(
+			operators.size() != 0 && (
+				operators.back().first->precedence > binaryOperator->precedence || (
+					operators.back().first->precedence == binaryOperator->precedence &&
+					binaryOperator->associativity == langgen::parser::Associativity::LEFT
+				)
+			)
+		) {
+			reduce();
+		}
+
+		operators.push_back({ binaryOperator, langgen::parser::mark(tokens) });
+		(void)eat(tokens);
+
+		std::shared_ptr<langgen::ast::Expression> operand = std::static_pointer_cast<langgen::ast::Expression>(table.parse_operand(tokens));
+		if(operand == nullptr) {
+			throw std::runtime_error("Expected an operand after operator \"" + langgen::parser::token_at(tokens, operators.back().second).value + "\"");
+		}
+		operands.push_back(std::move(operand));
+	}
+
+	while(operators.size() != 0) {
+		reduce();
+	}
+
+	return operands.back();
+}
+
 void langgen::parser::register_node(
 	langgen::parser::Parser& parser,
 	std::string key,
 	langgen::parser::Node node
 ) {
 	parser.nodesRegister[key] = node;
+	langgen::parser::compile_dispatch(parser);
+}
+
+void langgen::parser::set_first_tokens(
+	langgen::parser::Parser& parser,
+	std::string key,
+	std::vector<std::string> tokenTypes
+) {
+	std::vector<langgen::lexer::TokenKind>& firstKinds = parser.nodesRegister.at(key).firstKinds;
+	firstKinds.clear();
+	for(const std::string& tokenType : tokenTypes) {
+		firstKinds.push_back(langgen::lexer::token_kind(tokenType));
+	}
+	langgen::parser::compile_dispatch(parser);
+}
+
+void langgen::parser::set_priority(
+	langgen::parser::Parser& parser,
+	std::string key,
+	int priority
+) {
+	parser.nodesRegister.at(key).priority = priority;
+	langgen::parser::compile_dispatch(parser);
+}
+
+void langgen::parser::compile_dispatch(langgen::parser::Parser& parser) {
+	std::vector<std::pair<std::string, std::shared_ptr<const langgen::parser::Node>>> topNodes;
+	for(const auto& [key, node] : parser.nodesRegister) {
+		if(node.isTopNode) {
+			std::shared_ptr<langgen::parser::Node> dispatchNode = std::make_shared<langgen::parser::Node>(node);
+			dispatchNode->key = key;
+			topNodes.push_back({ key, dispatchNode });
+		}
+	}
+
+	// Deterministic order, whatever the order of the register
+	std::sort(
+		topNodes.begin(),
+		topNodes.end(),
+		[](
+			const std::pair<std::string, std::shared_ptr<const langgen::parser::Node>>& left,
+			const std::pair<std::string, std::shared_ptr<const langgen::parser::Node>>& right
+		) {
+			if(left.second->priority != right.second->priority) {
+				return left.second->priority > right.second->priority;
+			}
+			return left.first < right.first;
+		}
+	);
+
+	parser.firstDispatch.clear();
+	parser.anyDispatch.clear();
+
+	for(const auto& [key, node] : topNodes) {
+		if(node->firstKinds.size() == 0) {
+			parser.anyDispatch.push_back(node);
+		}
+		for(langgen::lexer::TokenKind kind : node->firstKinds) {
+			parser.firstDispatch.insert({ kind, {} });
+		}
+	}
+
+	// The nodes starting with any token are candidates for every kind, interleaved by priority
+	for(const auto& [key, node] : topNodes) {
+		for(auto& [kind, candidates] : parser.firstDispatch) {
+			if(
+				node->firstKinds.size() == 0 ||
+				std::find(node->firstKinds.begin(), node->firstKinds.end(), kind) != node->firstKinds.end()
+			) {
+				candidates.push_back(node);
+			}
+		}
+	}
+
+	parser.dispatchCompiled = true;
 }
 
 void langgen::parser::setup_parser(
@@ -50,37 +326,215 @@ void langgen::parser::setup_parser(
 	langgen::parser::register_node(
 		parser,
 		"NumberExpression",
-		langgen::parser::make_node(&parse_number_expression)
+		langgen::parser::make_node(
+			[](langgen::parser::TokenStream& tokens) -> std::shared_ptr<langgen::ast::Statement> {
+				return langgen::parser::parse_number_expression(tokens);
+			}
+		)
 	);
 }
 
+std::shared_ptr<langgen::ast::Statement> langgen::parser::parse_node(
+	langgen::parser::TokenStream& tokens,
+	const std::string& key
+) {
+	if(tokens.parser == nullptr) {
+		throw std::runtime_error("Trying to parse node " + key + " outside of parse_statement");
+	}
+
+	auto node = tokens.parser->nodesRegister.find(key);
+	if(node == tokens.parser->nodesRegister.end()) {
+		throw std::runtime_error("Trying to parse unknown node " + key);
+	}
+
+	std::shared_ptr<langgen::ast::Statement> statement = node->second.parse_stream_node ?
+		node->second.parse_stream_node(tokens) :
+		langgen::parser::make_node(node->second.parse_node).parse_stream_node(tokens);
+
+	LANGGEN_STATS_RECORD(stats, langgen::stats::count_node(*stats, key, statement != nullptr));
+
+	return statement;
+}
+
 std::shared_ptr<langgen::ast::Statement> langgen::parser::parse_statement(
 	langgen::parser::Parser& parser,
 	std::vector<langgen::lexer::Token>& tokens
 ) {
-	std::shared_ptr<langgen::ast::Statement> statement = nullptr;
+	langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+	std::shared_ptr<langgen::ast::Statement> statement = langgen::parser::parse_statement(parser, stream);
+	langgen::parser::compact(stream);
+	return statement;
+}
 
-	for(auto& [key, node] : parser.nodesRegister) {
-		if(node.isTopNode && statement == nullptr) {
-			statement = node.parse_node(tokens);
-		}
+std::shared_ptr<langgen::ast::Statement> langgen::parser::parse_statement(
+	langgen::parser::Parser& parser,
+	langgen::parser::TokenStream& tokens
+) {
+	if(!parser.dispatchCompiled) {
+		langgen::parser::compile_dispatch(parser);
 	}
 
-	if(statement == nullptr) {
-		throw std::runtime_error("Unknown token : \"" + peek(tokens).type + "\"");
+	tokens.parser = &parser;
+
+	auto firstCandidates = parser.firstDispatch.find(peek(tokens).kind);
+	const std::vector<std::shared_ptr<const langgen::parser::Node>>& candidates = firstCandidates != parser.firstDispatch.end() ?
+		firstCandidates->second :
+		parser.anyDispatch;
+
+	size_t start = langgen::parser::mark(tokens);
+
+	for(const std::shared_ptr<const langgen::parser::Node>& node : candidates) {
+		std::shared_ptr<langgen::ast::Statement> statement = node->parse_stream_node ?
+			node->parse_stream_node(tokens) :
+			langgen::parser::make_node(node->parse_node).parse_stream_node(tokens);
+
+		LANGGEN_STATS_RECORD(stats, langgen::stats::count_node(*stats, node->key, statement != nullptr));
+
+		if(statement != nullptr) {
+			return statement;
+		}
+
+		// Nodes with the legacy signature erase the tokens they consume, they can not be backtracked
+		if(start >= tokens.base) {
+			langgen::parser::reset(tokens, start);
+		}
 	}
 
-	return statement;
+	throw std::runtime_error("Unknown token : \"" + peek(tokens).type + "\"");
 }
 
 void langgen::parser::parse(
 	langgen::parser::Parser& parser,
 	std::shared_ptr<langgen::ast::Scope> program,
-	std::vector<langgen::lexer::Token>& tokens
+	std::vector<langgen::lexer::Token>& tokens,
+	langgen::stats::Stats* stats
 ) {
-	while(peek(tokens).type != "EOF") {
+	langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+	langgen::parser::parse(parser, program, stream, stats);
+	langgen::parser::compact(stream);
+}
+
+void langgen::parser::parse(
+	langgen::parser::Parser& parser,
+	std::shared_ptr<langgen::ast::Scope> program,
+	langgen::parser::TokenStream& tokens,
+	langgen::stats::Stats* stats
+) {
+	langgen::stats::PhaseRecorder recorder(stats, langgen::stats::Phase::PARSE);
+
+	if(parser.useArena) {
+		if(program->arena == nullptr) {
+			program->arena = std::make_shared<langgen::ast::Arena>();
+		}
+		tokens.arena = program->arena.get();
+	}
+
+	while(peek(tokens).kind != langgen::lexer::EOF_TOKEN_KIND) {
+		size_t start = langgen::parser::mark(tokens);
 		program->body.push_back(
 			parse_statement(parser, tokens)
 		);
+		program->spans.push_back(langgen::ast::TokenSpan{start, langgen::parser::mark(tokens)});
+		tokens.memo.clear();
+		// Release the tokens of the parsed statement
+		if(tokens.source != nullptr) {
+			langgen::parser::compact(tokens);
+		}
 	}
-}
\ No newline at end of file
+}
+
+void langgen::parser::parse(
+	langgen::parser::Parser& parser,
+	std::shared_ptr<langgen::ast::Scope> program,
+	langgen::lexer::TokenSource& source,
+	langgen::stats::Stats* stats
+) {
+	std::vector<langgen::lexer::Token> tokens;
+	langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+	stream.source = &source;
+	langgen::parser::parse(parser, program, stream, stats);
+}
+
+langgen::lexer::Edit langgen::parser::reparse(
+	langgen::parser::Parser& parser,
+	std::shared_ptr<langgen::ast::Scope> program,
+	std::vector<langgen::lexer::Token>& tokens,
+	const langgen::lexer::Edit& edit
+) {
+	std::vector<std::shared_ptr<langgen::ast::Statement>>& body = program->body;
+	std::vector<langgen::ast::TokenSpan>& spans = program->spans;
+
+	if(spans.size() != body.size()) {
+		throw std::runtime_error("Trying to reparse a program without the token spans of its statements");
+	}
+
+	size_t editEnd = edit.offset + edit.inserted;
+
+	// The statement before the edit may have ended because of a token the edit replaced
+	size_t first = std::lower_bound(
+		spans.begin(),
+		spans.end(),
+		edit.offset,
+		[](const langgen::ast::TokenSpan& span, size_t offset) { return span.start < offset; }
+	) - spans.begin();
+	first = first >= 1 ? first - 1 : 0;
+
+	langgen::parser::TokenStream stream = langgen::parser::TokenStream{tokens};
+	stream.position = first == 0 ? 0 : spans[first].start;
+	// Not in the arena of the program : it never reuses the memory of the replaced statements, and would grow with every edit
+
+	std::vector<std::shared_ptr<langgen::ast::Statement>> parsed;
+	std::vector<langgen::ast::TokenSpan> parsedSpans;
+	size_t next = first;
+
+	while(true) {
+		if(peek(stream).kind == langgen::lexer::EOF_TOKEN_KIND) {
+			next = body.size();
+			break;
+		}
+
+		size_t start = langgen::parser::mark(stream);
+		parsed.push_back(langgen::parser::parse_statement(parser, stream));
+		size_t end = langgen::parser::mark(stream);
+		parsedSpans.push_back(langgen::ast::TokenSpan{start, end});
+		stream.memo.clear();
+
+		if(stream.base != 0) {
+			throw std::runtime_error("Trying to reparse with nodes erasing the tokens they consume");
+		}
+		if(end < editEnd) {
+			continue;
+		}
+
+		// Past the edit, both token lists are the same : parsing from where an old statement started gives the old statements
+		size_t oldEnd = end - edit.inserted + edit.removed;
+		while(next < body.size() && spans[next].start < oldEnd) {
+			next++;
+		}
+		if(next < body.size() && spans[next].start == oldEnd) {
+			break;
+		}
+	}
+
+	if(edit.removed != edit.inserted) {
+		for(size_t i = next; i < spans.size(); i++) {
+			spans[i].start = spans[i].start - edit.removed + edit.inserted;
+			spans[i].end = spans[i].end - edit.removed + edit.inserted;
+		}
+	}
+
+	// Replace in place what can be, to only move the following statements when the count changes
+	size_t removed = next - first;
+	size_t common = std::min(removed, parsed.size());
+	std::copy(parsed.begin(), parsed.begin() + common, body.begin() + first);
+	std::copy(parsedSpans.begin(), parsedSpans.begin() + common, spans.begin() + first);
+	if(removed > common) {
+		body.erase(body.begin() + first + common, body.begin() + next);
+		spans.erase(spans.begin() + first + common, spans.begin() + next);
+	} else {
+		body.insert(body.begin() + next, parsed.begin() + common, parsed.end());
+		spans.insert(spans.begin() + next, parsedSpans.begin() + common, parsedSpans.end());
+	}
+
+	return langgen::lexer::Edit{first, removed, parsed.size()};
+}
@@ -0,0 +1,113 @@
+#include <AquIce/langgen/resolver.hpp>
+
+void langgen::resolver::setup_resolver(
+	langgen::resolver::Resolver& resolver,
+	std::unordered_map<std::string, langgen::resolver::ResolveStatementFunction> nodeResolutionFunctions
+) {
+	resolver.nodeResolutionFunctions = nodeResolutionFunctions;
+	resolver.nodeResolutionFunctions["Scope"] = [] (
+		langgen::resolver::Resolver& resolver,
+		std::shared_ptr<langgen::ast::Statement> statement
+	) {
+		langgen::resolver::resolve_scope(
+			resolver,
+			std::dynamic_pointer_cast<langgen::ast::Scope>(statement)
+		);
+	};
+}
+
+std::optional<size_t> langgen::resolver::declare(
+	langgen::resolver::Resolver& resolver,
+	const std::string& key
+) {
+	if(resolver.scopes.size() == 0) {
+		throw std::runtime_error("Trying to declare " + key + " outside of a scope");
+	}
+
+	std::unordered_map<std::string, size_t>& scope = resolver.scopes.back();
+
+	if(scope.find(key) != scope.end()) {
+		// Left to the environment, which reports the redeclaration when it is evaluated
+		return std::nullopt;
+	}
+
+	size_t slot = resolver.nextSlots.back()++;
+	scope[key] = slot;
+	return slot;
+}
+
+std::optional<langgen::env::SlotAddress> langgen::resolver::lookup(
+	langgen::resolver::Resolver& resolver,
+	const std::string& key
+) {
+	for(size_t depth = 0; depth < resolver.scopes.size(); depth++) {
+		const std::unordered_map<std::string, size_t>& scope = resolver.scopes.at(resolver.scopes.size() - 1 - depth);
+		auto slot = scope.find(key);
+		if(slot != scope.end()) {
+			return langgen::env::SlotAddress{depth, slot->second};
+		}
+	}
+	return std::nullopt;
+}
+
+void langgen::resolver::resolve_statement(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Statement> statement
+) {
+	auto resolveFn = resolver.nodeResolutionFunctions.find(statement->type());
+	if(resolveFn != resolver.nodeResolutionFunctions.end()) {
+		resolveFn->second(resolver, statement);
+	}
+}
+
+/**
+ * Resolve the body of a scope in the innermost open scope, then close it
+ */
+static void resolve_body(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Scope> scope
+) {
+	for(const std::shared_ptr<langgen::ast::Statement>& statement : scope->body) {
+		langgen::resolver::resolve_statement(resolver, statement);
+	}
+
+	resolver.scopes.pop_back();
+	resolver.nextSlots.pop_back();
+}
+
+void langgen::resolver::resolve_scope(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Scope> scope
+) {
+	resolver.scopes.push_back(std::unordered_map<std::string, size_t>());
+	resolver.nextSlots.push_back(0);
+
+	resolve_body(resolver, scope);
+}
+
+void langgen::resolver::resolve(
+	langgen::resolver::Resolver& resolver,
+	std::shared_ptr<langgen::ast::Scope> program,
+	std::shared_ptr<langgen::env::Environment> env
+) {
+	resolver.scopes.clear();
+	resolver.nextSlots.clear();
+
+	if(env == nullptr) {
+		langgen::resolver::resolve_scope(resolver, program);
+		return;
+	}
+
+	// The program scope is the environment itself, its values keep their slots
+	const std::vector<std::string>& keys = env->get_keys();
+	std::unordered_map<std::string, size_t> scope;
+	for(size_t slot = 0; slot < keys.size(); slot++) {
+		if(keys[slot].length() != 0) {
+			scope[keys[slot]] = slot;
+		}
+	}
+	resolver.scopes.push_back(scope);
+	resolver.nextSlots.push_back(keys.size());
+
+	resolve_body(resolver, program);
+}
@@ -0,0 +1,152 @@
+#include <AquIce/langgen/stats.hpp>
+#include <AquIce/langgen/lexer.hpp>
+#include <AquIce/langgen/ast.hpp>
+
+#include <map>
+#include <sstream>
+
+static const std::array<std::string, 3> PHASE_NAMES = { "lex", "parse", "interpret" };
+static const std::array<std::string, 3> SENSITIVITY_NAMES = { "INIT", "SET", "GET" };
+
+/**
+ * Name the non-zero counters of a list, sorted by name
+ */
+template <typename NameFn>
+static std::map<std::string, size_t> named_counters(const std::vector<size_t>& counters, NameFn name) {
+	std::map<std::string, size_t> named;
+	for(size_t index = 0; index < counters.size(); index++) {
+		if(counters[index] != 0) {
+			named[name(index)] += counters[index];
+		}
+	}
+	return named;
+}
+
+static std::string json_string(const std::string& str) {
+	std::string escaped = "\"";
+	for(char c : str) {
+		if(c == '"' || c == '\\') {
+			escaped += '\\';
+			escaped += c;
+		} else if(static_cast<unsigned char>(c) < 0x20) {
+			const char* hex = "0123456789abcdef";
+			escaped += "\\u00";
+			escaped += hex[(c >> 4) & 0xf];
+			escaped += hex[c & 0xf];
+		} else {
+			escaped += c;
+		}
+	}
+	return escaped + "\"";
+}
+
+bool langgen::stats::enabled() {
+#ifdef LANGGEN_STATS
+	return true;
+#else
+	return false;
+#endif
+}
+
+langgen::stats::PhaseRecorder::PhaseRecorder(langgen::stats::Stats* stats, langgen::stats::Phase phase) {
+	this->stats = stats;
+	this->phase = phase;
+#ifdef LANGGEN_STATS
+	if(stats != nullptr) {
+		this->previous = langgen::stats::active();
+		langgen::stats::active() = stats;
+		this->start = std::chrono::steady_clock::now();
+	}
+#endif
+}
+
+langgen::stats::PhaseRecorder::~PhaseRecorder() {
+#ifdef LANGGEN_STATS
+	if(this->stats != nullptr) {
+		this->stats->seconds[static_cast<size_t>(this->phase)] += std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - this->start
+		).count();
+		langgen::stats::active() = this->previous;
+	}
+#endif
+}
+
+std::string langgen::stats::repr(const langgen::stats::Stats& stats) {
+	std::ostringstream out;
+
+	for(size_t phase = 0; phase < PHASE_NAMES.size(); phase++) {
+		out << PHASE_NAMES[phase] << ": " << stats.seconds[phase] * 1000 << " ms\n";
+	}
+
+	out << "tokens:\n";
+	for(const auto& [name, count] : named_counters(stats.tokens, &langgen::lexer::token_kind_name)) {
+		out << "\t" << name << ": " << count << "\n";
+	}
+
+	out << "nodes (attempts / failures):\n";
+	std::map<std::string, langgen::stats::NodeCounters> nodes(stats.nodes.begin(), stats.nodes.end());
+	for(const auto& [key, counters] : nodes) {
+		out << "\t" << key << ": " << counters.attempts << " / " << counters.failures << "\n";
+	}
+
+	out << "evaluations:\n";
+	for(const auto& [name, count] : named_counters(stats.evaluations, &langgen::ast::node_kind_name)) {
+		out << "\t" << name << ": " << count << "\n";
+	}
+
+	out << "lookups (by parents walked up):\n";
+	for(size_t hops = 0; hops < stats.lookups.size(); hops++) {
+		out << "\t" << hops << ": " << stats.lookups[hops] << "\n";
+	}
+
+	out << "validations:\n";
+	for(size_t sensitivity = 0; sensitivity < SENSITIVITY_NAMES.size(); sensitivity++) {
+		out << "\t" << SENSITIVITY_NAMES[sensitivity] << ": " << stats.validations[sensitivity] << "\n";
+	}
+
+	return out.str();
+}
+
+std::string langgen::stats::json(const langgen::stats::Stats& stats) {
+	std::ostringstream out;
+
+	out << "{\"seconds\":{";
+	for(size_t phase = 0; phase < PHASE_NAMES.size(); phase++) {
+		out << (phase == 0 ? "" : ",") << json_string(PHASE_NAMES[phase]) << ":" << stats.seconds[phase];
+	}
+
+	out << "},\"tokens\":{";
+	bool first = true;
+	for(const auto& [name, count] : named_counters(stats.tokens, &langgen::lexer::token_kind_name)) {
+		out << (first ? "" : ",") << json_string(name) << ":" << count;
+		first = false;
+	}
+
+	out << "},\"nodes\":{";
+	first = true;
+	std::map<std::string, langgen::stats::NodeCounters> nodes(stats.nodes.begin(), stats.nodes.end());
+	for(const auto& [key, counters] : nodes) {
+		out << (first ? "" : ",") << json_string(key) << ":{\"attempts\":" << counters.attempts << ",\"failures\":" << counters.failures << "}";
+		first = false;
+	}
+
+	out << "},\"evaluations\":{";
+	first = true;
+	for(const auto& [name, count] : named_counters(stats.evaluations, &langgen::ast::node_kind_name)) {
+		out << (first ? "" : ",") << json_string(name) << ":" << count;
+		first = false;
+	}
+
+	out << "},\"lookups\":[";
+	for(size_t hops = 0; hops < stats.lookups.size(); hops++) {
+		out << (hops == 0 ? "" : ",") << stats.lookups[hops];
+	}
+
+	out << "],\"validations\":{";
+	for(size_t sensitivity = 0; sensitivity < SENSITIVITY_NAMES.size(); sensitivity++) {
+		out << (sensitivity == 0 ? "" : ",") << json_string(SENSITIVITY_NAMES[sensitivity]) << ":" << stats.validations[sensitivity];
+	}
+	out << "}}";
+
+	return out.str();
+}
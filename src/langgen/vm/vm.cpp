@@ -0,0 +1,204 @@
+#include <AquIce/langgen/vm.hpp>
+
+void langgen::vm::setup_vm(
+	langgen::vm::VM& vm,
+	std::unordered_map<std::string, langgen::vm::CompileStatementFunction> nodeCompilationFunctions,
+	std::unordered_map<std::string, langgen::vm::OpcodeFunction> customOpcodes
+) {
+	vm.nodeCompilationFunctions = nodeCompilationFunctions;
+	vm.nodeCompilationFunctions["NumberExpression"] = [] (
+		langgen::vm::Compiler& compiler,
+		const std::shared_ptr<langgen::ast::Statement>& statement
+	) -> uint32_t {
+		uint32_t reg = langgen::vm::allocate_register(compiler);
+		langgen::vm::emit(
+			compiler,
+			langgen::vm::OP_LOAD_CONSTANT,
+			reg,
+			langgen::vm::add_constant(
+				compiler,
+				langgen::values::Value::number(std::static_pointer_cast<langgen::ast::NumberExpression>(statement)->value)
+			)
+		);
+		return reg;
+	};
+
+	vm.opcodes.clear();
+	vm.opcodeFunctions.clear();
+	for(const auto& [name, opcodeFn] : customOpcodes) {
+		vm.opcodes[name] = langgen::vm::OP_CUSTOM + static_cast<langgen::vm::Opcode>(vm.opcodeFunctions.size());
+		vm.opcodeFunctions.push_back(opcodeFn);
+	}
+}
+
+langgen::vm::Opcode langgen::vm::get_opcode(
+	langgen::vm::VM& vm,
+	const std::string& name
+) {
+	auto opcode = vm.opcodes.find(name);
+	if(opcode == vm.opcodes.end()) {
+		throw std::runtime_error("Trying to use unknown opcode " + name);
+	}
+	return opcode->second;
+}
+
+#pragma region Compiler
+
+uint32_t langgen::vm::allocate_register(langgen::vm::Compiler& compiler) {
+	uint32_t reg = compiler.registerTop++;
+	if(compiler.registerTop > compiler.program.registerCount) {
+		compiler.program.registerCount = compiler.registerTop;
+	}
+	return reg;
+}
+
+void langgen::vm::emit(
+	langgen::vm::Compiler& compiler,
+	langgen::vm::Opcode opcode,
+	uint32_t a,
+	uint32_t b,
+	uint32_t c
+) {
+	compiler.program.code.push_back(langgen::vm::Instruction{opcode, a, b, c});
+}
+
+uint32_t langgen::vm::add_constant(langgen::vm::Compiler& compiler, const langgen::values::Value& value) {
+	compiler.program.constants.push_back(value);
+	return static_cast<uint32_t>(compiler.program.constants.size() - 1);
+}
+
+uint32_t langgen::vm::add_name(langgen::vm::Compiler& compiler, const std::string& name) {
+	for(size_t i = 0; i < compiler.program.names.size(); i++) {
+		if(compiler.program.names[i] == name) {
+			return static_cast<uint32_t>(i);
+		}
+	}
+	compiler.program.names.push_back(name);
+	return static_cast<uint32_t>(compiler.program.names.size() - 1);
+}
+
+uint32_t langgen::vm::add_address(langgen::vm::Compiler& compiler, langgen::env::SlotAddress address) {
+	compiler.program.addresses.push_back(address);
+	return static_cast<uint32_t>(compiler.program.addresses.size() - 1);
+}
+
+uint32_t langgen::vm::add_declaration(langgen::vm::Compiler& compiler, langgen::vm::Declaration declaration) {
+	compiler.program.declarations.push_back(std::move(declaration));
+	return static_cast<uint32_t>(compiler.program.declarations.size() - 1);
+}
+
+uint32_t langgen::vm::add_statement(langgen::vm::Compiler& compiler, const std::shared_ptr<langgen::ast::Statement>& statement) {
+	compiler.program.statements.push_back(statement);
+	return static_cast<uint32_t>(compiler.program.statements.size() - 1);
+}
+
+uint32_t langgen::vm::compile_statement(
+	langgen::vm::Compiler& compiler,
+	const std::shared_ptr<langgen::ast::Statement>& statement
+) {
+	auto compileFn = compiler.vm->nodeCompilationFunctions.find(statement->type());
+	if(compileFn != compiler.vm->nodeCompilationFunctions.end()) {
+		return compileFn->second(compiler, statement);
+	}
+
+	uint32_t reg = langgen::vm::allocate_register(compiler);
+	langgen::vm::emit(
+		compiler,
+		langgen::vm::OP_EVALUATE,
+		reg,
+		langgen::vm::add_statement(compiler, statement)
+	);
+	return reg;
+}
+
+langgen::vm::Program langgen::vm::compile(
+	langgen::vm::VM& vm,
+	langgen::interpreter::Interpreter& interpreter,
+	std::shared_ptr<langgen::ast::Scope> program
+) {
+	langgen::vm::Compiler compiler = langgen::vm::Compiler{&vm, &interpreter};
+
+	for(const std::shared_ptr<langgen::ast::Statement>& statement : program->body) {
+		compiler.registerTop = 0;
+		uint32_t reg = langgen::vm::compile_statement(compiler, statement);
+		langgen::vm::emit(
+			compiler,
+			langgen::vm::OP_RESULT,
+			reg,
+			langgen::vm::add_statement(compiler, statement)
+		);
+	}
+
+	return compiler.program;
+}
+
+#pragma endregion
+
+langgen::values::Value langgen::vm::run(
+	langgen::vm::VM& vm,
+	langgen::interpreter::Interpreter& interpreter,
+	const langgen::vm::Program& program,
+	langgen::interpreter::ResultSink& sink,
+	std::shared_ptr<langgen::env::Environment> env
+) {
+	if(env == nullptr) {
+		env = std::make_shared<langgen::env::Environment>(
+			langgen::interpreter::get_env_schema(interpreter)
+		);
+	}
+
+	langgen::vm::Frame frame = langgen::vm::Frame{
+		&interpreter,
+		&program,
+		env,
+		std::vector<langgen::values::Value>(program.registerCount)
+	};
+	std::vector<langgen::values::Value>& registers = frame.registers;
+
+	langgen::values::Value result;
+
+	for(const langgen::vm::Instruction& instruction : program.code) {
+		switch(instruction.opcode) {
+			case langgen::vm::OP_LOAD_CONSTANT:
+				registers[instruction.a] = program.constants[instruction.b];
+				break;
+			case langgen::vm::OP_MOVE:
+				registers[instruction.a] = registers[instruction.b];
+				break;
+			case langgen::vm::OP_GET:
+				registers[instruction.a] = env->get(program.names[instruction.b]);
+				break;
+			case langgen::vm::OP_GET_AT:
+				registers[instruction.a] = env->get_at(program.addresses[instruction.b]);
+				break;
+			case langgen::vm::OP_SET:
+				registers[instruction.a] = env->set(program.names[instruction.b], registers[instruction.c]);
+				break;
+			case langgen::vm::OP_SET_AT:
+				registers[instruction.a] = env->set_at(program.addresses[instruction.b], registers[instruction.c]);
+				break;
+			case langgen::vm::OP_INIT: {
+				const langgen::vm::Declaration& declaration = program.declarations[instruction.b];
+				registers[instruction.a] = declaration.slot.has_value() ?
+					env->init_at(declaration.slot.value(), declaration.key, registers[instruction.c], declaration.properties) :
+					env->init(declaration.key, registers[instruction.c], declaration.properties);
+				break;
+			}
+			case langgen::vm::OP_EVALUATE:
+				registers[instruction.a] = langgen::interpreter::evaluate_value(interpreter, program.statements[instruction.b], env);
+				break;
+			case langgen::vm::OP_RESULT:
+				result = registers[instruction.a];
+				langgen::interpreter::record_result(sink, program.statements[instruction.b], result);
+				break;
+			default:
+				if(instruction.opcode - langgen::vm::OP_CUSTOM >= vm.opcodeFunctions.size()) {
+					throw std::runtime_error("Trying to run unknown opcode " + std::to_string(instruction.opcode));
+				}
+				vm.opcodeFunctions[instruction.opcode - langgen::vm::OP_CUSTOM](frame, instruction);
+				break;
+		}
+	}
+
+	return result;
+}